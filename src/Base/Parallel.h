@@ -0,0 +1,115 @@
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 51 Franklin Street,      *
+ *   Fifth Floor, Boston, MA  02110-1301, USA                              *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef BASE_PARALLEL_H
+#define BASE_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace Base
+{
+
+/// The number of threads of the parallel loops, at least one
+inline std::size_t parallelThreadCount()
+{
+    return std::max(1U, std::thread::hardware_concurrency());
+}
+
+/*!
+ Call func(index) for every index in [0, count). Up to maxThreads threads, the calling thread
+ included, take the next index from a shared counter, so the items are not handled in order and
+ the biggest ones should come first. With a single thread the items are handled in order by the
+ calling thread.
+
+ If func throws, the other items are still handled and the exception of the lowest index is
+ rethrown when all threads are done.
+ */
+template<typename Func>
+void parallelFor(std::size_t count, Func func, std::size_t maxThreads = parallelThreadCount())
+{
+    std::atomic<std::size_t> next {0};
+    std::exception_ptr error;
+    std::size_t errorIndex = count;
+    std::mutex mutex;
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < count; i = next++) {
+            try {
+                func(i);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (i < errorIndex) {
+                    errorIndex = i;
+                    error = std::current_exception();
+                }
+            }
+        }
+    };
+    std::size_t threads = std::min(maxThreads, count);
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < threads; ++i) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/*!
+ The number of ranges count items are split into by parallelForRanges(): at least minRange items
+ per range and at most four ranges per thread for a better balance.
+ */
+inline std::size_t parallelRangeCount(std::size_t count, std::size_t minRange)
+{
+    return std::max<std::size_t>(1, std::min(4 * parallelThreadCount(), count / minRange));
+}
+
+/*!
+ Split [0, count) into parallelRangeCount() ranges and call func(begin, end) for every range with
+ parallelFor(). Use it when every task has some setup cost, so that the tasks are not too small.
+ */
+template<typename Func>
+void parallelForRanges(std::size_t count, std::size_t minRange, Func func)
+{
+    std::size_t ranges = parallelRangeCount(count, minRange);
+    parallelFor(ranges, [&](std::size_t index) {
+        func(count * index / ranges, count * (index + 1) / ranges);
+    });
+}
+
+}  // namespace Base
+
+#endif  // BASE_PARALLEL_H
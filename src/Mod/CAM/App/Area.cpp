@@ -72,6 +72,7 @@
 #include <App/Application.h>
 #include <App/Document.h>
 #include <Base/Exception.h>
+#include <Base/Parallel.h>
 #include <Mod/Part/App/CrossSection.h>
 #include <Mod/Part/App/FaceMakerBullseye.h>
 #include <Mod/Part/App/PartFeature.h>
@@ -144,8 +145,16 @@ void AreaParams::dump(const char* msg) const
     }
 }
 
+// set while the thread processes sections with frozen libarea settings
+static thread_local bool s_areaConfigLocked = false;
+
 CAreaConfig::CAreaConfig(const CAreaParams& p, bool noFitArcs)
+    : myLocked(s_areaConfigLocked)
 {
+    if (myLocked) {
+        return;
+    }
+
 #define AREA_CONF_SAVE_AND_APPLY(_param)                                                           \
     PARAM_FNAME(_param) = BOOST_PP_CAT(CArea::get_, PARAM_FARG(_param))();                         \
     BOOST_PP_CAT(CArea::set_, PARAM_FARG(_param))(p.PARAM_FNAME(_param));
@@ -160,6 +169,9 @@ CAreaConfig::CAreaConfig(const CAreaParams& p, bool noFitArcs)
 
 CAreaConfig::~CAreaConfig()
 {
+    if (myLocked) {
+        return;
+    }
 
 #define AREA_CONF_RESTORE(_param)                                                                  \
     BOOST_PP_CAT(CArea::set_, PARAM_FARG(_param))(PARAM_FNAME(_param));
@@ -167,11 +179,22 @@ CAreaConfig::~CAreaConfig()
     PARAM_FOREACH(AREA_CONF_RESTORE, AREA_PARAMS_CAREA);
 }
 
+CAreaConfig::Lock::Lock()
+    : myPrevious(s_areaConfigLocked)
+{
+    s_areaConfigLocked = true;
+}
+
+CAreaConfig::Lock::~Lock()
+{
+    s_areaConfigLocked = myPrevious;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 TYPESYSTEM_SOURCE(Path::Area, Base::BaseClass)
 
-bool Area::s_aborting;
+std::atomic<bool> Area::s_aborting {false};
 
 Area::Area(const AreaParams* params)
     : myParams(s_params)
@@ -1886,7 +1909,10 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
     bool can_retry = fabs(tolerance) > Precision::Confusion();
     TopLoc_Location locInverse(loc.Inverted());
 
-    for (size_t i = 0; i < heights.size(); ++i) {
+    // Each section only reads the shared shapes, so they can be made concurrently. Empty
+    // sections are discarded once all of them are done, to keep them in order.
+    std::vector<shared_ptr<Area>> results(heights.size());
+    auto makeSection = [&](size_t i) {
         double z = heights[i];
         bool retried = !can_retry;
         while (true) {
@@ -1907,7 +1933,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                     TopLoc_Location wloc(t);
                     area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
                 }
-                sections.push_back(area);
+                results[i] = area;
                 break;
             }
 
@@ -1984,7 +2010,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                 }
             }
             if (!area->myShapes.empty()) {
-                sections.push_back(area);
+                results[i] = area;
                 FC_TIME_LOG(t1, "makeSection " << z);
                 showShape(area->getShape(), nullptr, "section_%u_final", i);
                 break;
@@ -1999,6 +2025,12 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                 retried = true;
             }
         }
+    };
+    foreachSection(heights.size(), makeSection);
+    for (auto& area : results) {
+        if (area) {
+            sections.push_back(std::move(area));
+        }
     }
     FC_TIME_LOG(t, "makeSection count: " << sections.size() << ", total");
     return sections;
@@ -2212,11 +2244,14 @@ TopoDS_Shape Area::toShape(CArea& area, short fill, int reorient)
             if (_index >= (int)mySections.size())                                                  \
                 return TopoDS_Shape();                                                             \
             if (_index < 0) {                                                                      \
+                std::vector<TopoDS_Shape> shapes(mySections.size());                               \
+                foreachSection(mySections.size(), [&](std::size_t i) {                             \
+                    shapes[i] = mySections[i]->_op(_index, ##__VA_ARGS__);                         \
+                });                                                                                \
                 BRep_Builder builder;                                                              \
                 TopoDS_Compound compound;                                                          \
                 builder.MakeCompound(compound);                                                    \
-                for (shared_ptr<Area> area : mySections) {                                         \
-                    const TopoDS_Shape& s = area->_op(_index, ##__VA_ARGS__);                      \
+                for (const TopoDS_Shape& s : shapes) {                                             \
                     if (s.IsNull())                                                                \
                         continue;                                                                  \
                     builder.Add(compound, s);                                                      \
@@ -4191,6 +4226,34 @@ void Area::toPath(Toolpath& path,
     }
 }
 
+void Area::foreachSection(std::size_t count, const std::function<void(std::size_t)>& func) const
+{
+    // Debug output, including the shapes shown at trace level, needs the sections in order
+    if (!myParams.SectionParallel || count < 2 || FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (aborting()) {
+                throw Base::AbortException("Area operation aborted");
+            }
+            func(i);
+        }
+        return;
+    }
+
+    // libarea keeps its settings in static variables. Apply them once for all workers.
+    CAreaConfig conf(myParams);
+
+    Base::parallelFor(count, [&](std::size_t i) {
+        if (aborting()) {
+            return;
+        }
+        CAreaConfig::Lock lock;
+        func(i);
+    });
+    if (aborting()) {
+        throw Base::AbortException("Area operation aborted");
+    }
+}
+
 void Area::abort(bool aborting)
 {
     s_aborting = aborting;
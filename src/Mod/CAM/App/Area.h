@@ -23,7 +23,9 @@
 #ifndef PATH_AREA_H
 #define PATH_AREA_H
 
+#include <atomic>
 #include <chrono>
+#include <functional>
 #include <list>
 #include <memory>
 #include <vector>
@@ -104,6 +106,26 @@ struct PathExport CAreaConfig
 
     /** The destructor restores the setting, and thus exception safe.  */
     ~CAreaConfig();
+
+    /** Freeze the current libarea settings for the calling thread
+     *
+     * Sections are processed concurrently with one set of parameters, applied
+     * once by the caller. Every section worker holds a lock, so that the
+     * configurators running on the worker neither apply nor restore anything
+     * and threads do not race on the static settings. Configurators on other
+     * threads are not affected.
+     */
+    struct PathExport Lock
+    {
+        Lock();
+        ~Lock();
+
+    private:
+        bool myPrevious;
+    };
+
+private:
+    bool myLocked;
 };
 
 
@@ -141,12 +163,16 @@ protected:
     bool myProjecting;
     mutable int mySkippedShapes;
 
-    static bool s_aborting;
+    static std::atomic<bool> s_aborting;
     static AreaStaticParams s_params;
 
     /** Called internally to combine children shapes for further processing */
     void build();
 
+    /** Called internally to run \a func for each index below \a count, concurrently
+     * if #AREA_PARAMS_SECTION parallel option is enabled. Throws if aborted. */
+    void foreachSection(std::size_t count, const std::function<void(std::size_t)>& func) const;
+
     /** Called by build() to add children shape
      *
      * Mainly for checking if there is any faces for auto fill*/
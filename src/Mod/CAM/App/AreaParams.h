@@ -281,7 +281,14 @@
          "When the section hits or over the shape boundary, a section with the height of that "    \
          "boundary\n"                                                                              \
          "will be created. A small offset is usually required to avoid the tangential cut.",       \
-         App::PropertyPrecision))AREA_PARAMS_SECTION_EXTRA
+         App::PropertyPrecision))(                                                                 \
+        (bool,                                                                                     \
+         parallel,                                                                                 \
+         SectionParallel,                                                                          \
+         false,                                                                                    \
+         "Slice, clip, offset and pocket the sections concurrently.\n"                             \
+         "The sections are still assembled in order. Ignored when Path.Area logging is enabled.")) \
+        AREA_PARAMS_SECTION_EXTRA
 
 #ifdef AREA_OFFSET_ALGO
 #define AREA_PARAMS_OFFSET_ALGO ((enum, algo, Algo, 0, "Offset algorithm type", (Clipper)(libarea)))
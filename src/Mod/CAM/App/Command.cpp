@@ -22,8 +22,12 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <cctype>
+#include <charconv>
 #include <cinttypes>
-#include <iomanip>
+#include <cmath>
+#include <cstdlib>
 #include <boost/algorithm/string.hpp>
 #endif
 
@@ -96,14 +100,20 @@ bool Command::has(const std::string& attr) const
 
 std::string Command::toGCode(int precision, bool padzero) const
 {
-    std::stringstream str;
-    str.fill('0');
-    str << Name;
+    std::string str;
+    appendGCode(str, precision, padzero);
+    return str;
+}
+
+void Command::appendGCode(std::string& str, int precision, bool padzero) const
+{
+    str += Name;
     if (precision < 0) {
         precision = 0;
     }
     double scale = std::pow(10.0, precision + 1);
     std::int64_t iscale = static_cast<std::int64_t>(scale) / 10;
+    char buf[32];
     for (std::map<std::string, double>::const_iterator i = Parameters.begin();
          i != Parameters.end();
          ++i) {
@@ -111,16 +121,17 @@ std::string Command::toGCode(int precision, bool padzero) const
             continue;
         }
 
-        str << " " << i->first;
+        str += ' ';
+        str += i->first;
 
         std::int64_t v = static_cast<std::int64_t>(i->second * scale);
         if (v < 0) {
             v = -v;
-            str << '-';  // shall we allow -0 ?
+            str += '-';  // shall we allow -0 ?
         }
         v += 5;
         v /= 10;
-        str << (v / iscale);
+        str.append(buf, std::to_chars(buf, buf + sizeof(buf), v / iscale).ptr);
         if (!precision) {
             continue;
         }
@@ -136,82 +147,111 @@ std::string Command::toGCode(int precision, bool padzero) const
                 --width;
             }
         }
-        str << '.' << std::setw(width) << std::right << digits;
+        char* end = std::to_chars(buf, buf + sizeof(buf), digits).ptr;
+        str += '.';
+        str.append(std::max(0, width - static_cast<int>(end - buf)), '0');
+        str.append(buf, end);
+    }
+}
+
+static double parseValue(const std::string& value)
+{
+    double val = 0.0;
+#if defined(__cpp_lib_to_chars)
+    std::from_chars(value.data(), value.data() + value.size(), val);
+#else
+    val = std::atof(value.c_str());
+#endif
+    return val;
+}
+
+static void toUpper(std::string& str)
+{
+    for (char& c : str) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
     }
-    return str.str();
 }
 
 void Command::setFromGCode(const std::string& str)
 {
+    setFromGCode(str.data(), str.data() + str.size());
+}
+
+void Command::setFromGCode(const char* begin, const char* end)
+{
+    enum class Mode
+    {
+        None,
+        Command,
+        Argument,
+        Comment,
+    };
+
     Parameters.clear();
-    std::string mode = "none";
+    Mode mode = Mode::None;
     std::string key;
     std::string value;
-    for (unsigned int i = 0; i < str.size(); i++) {
-        if ((isdigit(str[i])) || (str[i] == '-') || (str[i] == '.')) {
-            value += str[i];
+    for (const char* it = begin; it != end; ++it) {
+        char c = *it;
+        if ((isdigit(c)) || (c == '-') || (c == '.')) {
+            value += c;
         }
-        else if (isalpha(str[i])) {
-            if (mode == "command") {
+        else if (isalpha(c)) {
+            if (mode == Mode::Command) {
                 if (!key.empty() && !value.empty()) {
-                    std::string cmd = key + value;
-                    boost::to_upper(cmd);
-                    Name = cmd;
-                    key = "";
-                    value = "";
-                    mode = "argument";
+                    Name = key + value;
+                    toUpper(Name);
+                    key.clear();
+                    value.clear();
                 }
                 else {
                     throw Base::BadFormatError("Badly formatted GCode command");
                 }
-                mode = "argument";
+                mode = Mode::Argument;
             }
-            else if (mode == "none") {
-                mode = "command";
+            else if (mode == Mode::None) {
+                mode = Mode::Command;
             }
-            else if (mode == "argument") {
+            else if (mode == Mode::Argument) {
                 if (!key.empty() && !value.empty()) {
-                    double val = std::atof(value.c_str());
-                    boost::to_upper(key);
-                    Parameters[key] = val;
-                    key = "";
-                    value = "";
+                    toUpper(key);
+                    Parameters[key] = parseValue(value);
+                    key.clear();
+                    value.clear();
                 }
                 else {
                     throw Base::BadFormatError("Badly formatted GCode argument");
                 }
             }
-            else if (mode == "comment") {
-                value += str[i];
+            else if (mode == Mode::Comment) {
+                value += c;
             }
-            key = str[i];
+            key.assign(1, c);
         }
-        else if (str[i] == '(') {
-            mode = "comment";
+        else if (c == '(') {
+            mode = Mode::Comment;
         }
-        else if (str[i] == ')') {
+        else if (c == ')') {
             key = "(";
             value += ")";
         }
         else {
             // add non-ascii characters only if this is a comment
-            if (mode == "comment") {
-                value += str[i];
+            if (mode == Mode::Comment) {
+                value += c;
             }
         }
     }
     if (!key.empty() && !value.empty()) {
-        if ((mode == "command") || (mode == "comment")) {
-            std::string cmd = key + value;
-            if (mode == "command") {
-                boost::to_upper(cmd);
+        if ((mode == Mode::Command) || (mode == Mode::Comment)) {
+            Name = key + value;
+            if (mode == Mode::Command) {
+                toUpper(Name);
             }
-            Name = cmd;
         }
         else {
-            double val = std::atof(value.c_str());
-            boost::to_upper(key);
-            Parameters[key] = val;
+            toUpper(key);
+            Parameters[key] = parseValue(value);
         }
     }
     else {
@@ -57,8 +57,13 @@ public:
     std::string
     toGCode(int precision = 6,
             bool padzero = true) const;  // returns a GCode string representation of the command
+    void appendGCode(std::string&,
+                     int precision = 6,
+                     bool padzero = true) const;  // appends the GCode representation to a string
     void setFromGCode(
         const std::string&);  // sets the parameters from the contents of the given GCode string
+    void setFromGCode(const char* begin,
+                      const char* end);  // same as above, for the characters in [begin, end)
     void setFromPlacement(
         const Base::Placement&);  // sets the parameters from the contents of the given placement
     bool
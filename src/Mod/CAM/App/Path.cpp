@@ -21,9 +21,17 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <exception>
+#include <memory>
+#endif
 
 #include <App/Application.h>
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/Writer.h>
@@ -304,76 +312,97 @@ Base::BoundBox3d Toolpath::getBoundBox() const
     return visitor.bb;
 }
 
-static void
-bulkAddCommand(const std::string& gcodestr, std::vector<Command*>& commands, bool& inches)
-{
-    Command* cmd = new Command();
-    cmd->setFromGCode(gcodestr);
-    if ("G20" == cmd->Name) {
-        inches = true;
-        delete cmd;
-    }
-    else if ("G21" == cmd->Name) {
-        inches = false;
-        delete cmd;
-    }
-    else {
-        if (inches) {
-            cmd->scaleBy(25.4);
-        }
-        commands.push_back(cmd);
-    }
-}
+// Commands are parsed concurrently in chunks of this many commands once there are more
+// than one chunk of them; this keeps small paths on the calling thread.
+static const std::size_t parseChunkSize = 4096;
 
 void Toolpath::setFromGCode(const std::string instr)
 {
     clear();
 
-    // remove comments
-    // boost::regex e("\\(.*?\\)");
-    // std::string str = boost::regex_replace(instr, e, "");
-    std::string str(instr);
-
     // split input string by () or G or M commands
+    const char* str = instr.c_str();
+    std::vector<std::pair<std::size_t, std::size_t>> segments;
     std::string mode = "command";
-    std::size_t found = str.find_first_of("(gGmM");
+    std::size_t found = instr.find_first_of("(gGmM");
     int last = -1;
-    bool inches = false;
     while (found != std::string::npos) {
         if (str[found] == '(') {
             // start of comment
             if ((last > -1) && (mode == "command")) {
                 // before opening a comment, add the last found command
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+                segments.emplace_back(last, found);
             }
             mode = "comment";
             last = found;
-            found = str.find_first_of(')', found + 1);
+            found = instr.find_first_of(')', found + 1);
         }
         else if (str[found] == ')') {
             // end of comment
-            std::string gcodestr = str.substr(last, found - last + 1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
+            segments.emplace_back(last, found + 1);
             last = -1;
-            found = str.find_first_of("(gGmM", found + 1);
+            found = instr.find_first_of("(gGmM", found + 1);
             mode = "command";
         }
         else if (mode == "command") {
             // command
             if (last > -1) {
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+                segments.emplace_back(last, found);
             }
             last = found;
-            found = str.find_first_of("(gGmM", found + 1);
+            found = instr.find_first_of("(gGmM", found + 1);
         }
     }
     // add the last command found, if any
     if (last > -1) {
         if (mode == "command") {
-            std::string gcodestr = str.substr(last, std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
+            segments.emplace_back(last, instr.size());
+        }
+    }
+
+    // parse the commands, keeping the first error of each chunk
+    std::vector<std::unique_ptr<Command>> commands(segments.size());
+    std::size_t chunks = (segments.size() + parseChunkSize - 1) / parseChunkSize;
+    std::vector<std::size_t> failed(chunks, segments.size());
+    std::vector<std::exception_ptr> errors(chunks);
+    Base::parallelFor(chunks, [&](std::size_t chunk) {
+        std::size_t end = std::min(segments.size(), (chunk + 1) * parseChunkSize);
+        for (std::size_t i = chunk * parseChunkSize; i < end; i++) {
+            try {
+                commands[i] = std::make_unique<Command>();
+                commands[i]->setFromGCode(str + segments[i].first, str + segments[i].second);
+            }
+            catch (...) {
+                failed[chunk] = i;
+                errors[chunk] = std::current_exception();
+                break;
+            }
+        }
+    });
+
+    // add the commands in order up to the first error, applying the unit changes
+    vpcCommands.reserve(commands.size());
+    bool inches = false;
+    for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+        std::size_t end = std::min(failed[chunk], (chunk + 1) * parseChunkSize);
+        for (std::size_t i = chunk * parseChunkSize; i < end; i++) {
+            std::unique_ptr<Command>& cmd = commands[i];
+            if ("G20" == cmd->Name) {
+                inches = true;
+            }
+            else if ("G21" == cmd->Name) {
+                inches = false;
+            }
+            else {
+                if (inches) {
+                    cmd->scaleBy(25.4);
+                }
+                vpcCommands.push_back(cmd.release());
+            }
+        }
+        if (errors[chunk]) {
+            recalculate();
+            std::rethrow_exception(errors[chunk]);
         }
     }
     recalculate();
@@ -381,11 +410,30 @@ void Toolpath::setFromGCode(const std::string instr)
 
 std::string Toolpath::toGCode() const
 {
+    // format chunks of commands concurrently and join them
+    std::size_t chunks = (vpcCommands.size() + parseChunkSize - 1) / parseChunkSize;
+    std::vector<std::string> results(chunks);
+    Base::parallelFor(chunks, [&](std::size_t chunk) {
+        std::size_t end = std::min(vpcCommands.size(), (chunk + 1) * parseChunkSize);
+        std::string& result = results[chunk];
+        result.reserve((end - chunk * parseChunkSize) * 32);
+        for (std::size_t i = chunk * parseChunkSize; i < end; i++) {
+            vpcCommands[i]->appendGCode(result);
+            result += '\n';
+        }
+    });
+
+    if (results.size() == 1) {
+        return std::move(results.front());
+    }
+    std::size_t size = 0;
+    for (const auto& result : results) {
+        size += result.size();
+    }
     std::string result;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        result += (*it)->toGCode();
-        result += "\n";
+    result.reserve(size);
+    for (const auto& chunk : results) {
+        result += chunk;
     }
     return result;
 }
@@ -473,6 +521,17 @@ static void saveCenter(Writer& writer, const Base::Vector3d& center)
                     << "\" z=\"" << center.z << "\"/>" << std::endl;
 }
 
+// Older versions read any path file as G-code text, so the binary file has to be enabled
+static bool saveBinary()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/CAM");
+    return hGrp->GetBool("BinaryPathFile", false);
+}
+
+// schema version of documents with a G-code text path file
+static const int textSchemaVersion = 2;
+
 void Toolpath::Save(Writer& writer) const
 {
     if (writer.isForceXML()) {
@@ -486,9 +545,11 @@ void Toolpath::Save(Writer& writer) const
         writer.decInd();
     }
     else {
+        bool binary = saveBinary();
+        std::string fileName = writer.ObjectName + (binary ? ".path" : ".nc");
         writer.Stream() << writer.ind() << "<Path file=\""
-                        << writer.addFile((writer.ObjectName + ".nc").c_str(), this)
-                        << "\" version=\"" << SchemaVersion << "\">" << std::endl;
+                        << writer.addFile(fileName.c_str(), this) << "\" version=\""
+                        << (binary ? SchemaVersion : textSchemaVersion) << "\">" << std::endl;
         writer.incInd();
         saveCenter(writer, center);
         writer.decInd();
@@ -496,12 +557,117 @@ void Toolpath::Save(Writer& writer) const
     writer.Stream() << writer.ind() << "</Path>" << std::endl;
 }
 
+// The binary path file stores the commands column by column: the command names as indices
+// into a name table, a mask of the fixed parameters each command has, one column of values
+// per fixed parameter and finally the remaining parameters of the commands that have any.
+// Values are stored exactly, whereas the G-code text is rounded.
+
+static const uint32_t binaryMagic = 0x50544346;  // "FCTP"
+static const std::array<const char*, 10> binaryParams {"X",
+                                                       "Y",
+                                                       "Z",
+                                                       "A",
+                                                       "B",
+                                                       "C",
+                                                       "I",
+                                                       "J",
+                                                       "K",
+                                                       "F"};
+static const uint16_t binaryExtraParams = 1 << 15;
+// command names and parameter names, comments are the longest ones
+static const uint32_t binaryMaxString = 1 << 20;
+
+static void writeString(Base::OutputStream& str, std::ostream& out, const std::string& value)
+{
+    str << (uint32_t)value.size();
+    out.write(value.c_str(), std::streamsize(value.size()));
+}
+
+static std::string readString(Base::InputStream& str, std::istream& in)
+{
+    uint32_t size = 0;
+    str >> size;
+    if (!in || size > binaryMaxString) {
+        throw Base::FileException("Invalid path file");
+    }
+    std::string value(size, '\0');
+    in.read(&value[0], size);
+    return value;
+}
+
 void Toolpath::SaveDocFile(Base::Writer& writer) const
 {
-    if (toGCode().empty()) {
+    if (!saveBinary()) {
+        writer.Stream() << toGCode();
         return;
     }
-    writer.Stream() << toGCode();
+
+    std::ostream& out = writer.Stream();
+    Base::OutputStream str(out);
+    str << binaryMagic << (uint32_t)vpcCommands.size();
+
+    std::map<std::string, uint32_t> nameIndex;
+    std::vector<const std::string*> names;
+    std::vector<uint32_t> nameColumn;
+    std::vector<uint16_t> maskColumn;
+    nameColumn.reserve(vpcCommands.size());
+    maskColumn.reserve(vpcCommands.size());
+    for (const Command* cmd : vpcCommands) {
+        auto res = nameIndex.emplace(cmd->Name, (uint32_t)names.size());
+        if (res.second) {
+            names.push_back(&res.first->first);
+        }
+        nameColumn.push_back(res.first->second);
+
+        uint16_t mask = 0;
+        std::size_t fixed = 0;
+        for (std::size_t i = 0; i < binaryParams.size(); i++) {
+            if (cmd->Parameters.count(binaryParams[i]) > 0) {
+                mask |= 1 << i;
+                ++fixed;
+            }
+        }
+        if (fixed < cmd->Parameters.size()) {
+            mask |= binaryExtraParams;
+        }
+        maskColumn.push_back(mask);
+    }
+
+    str << (uint32_t)names.size();
+    for (const std::string* name : names) {
+        writeString(str, out, *name);
+    }
+    for (uint32_t index : nameColumn) {
+        str << index;
+    }
+    for (uint16_t mask : maskColumn) {
+        str << mask;
+    }
+    for (std::size_t i = 0; i < binaryParams.size(); i++) {
+        for (std::size_t j = 0; j < vpcCommands.size(); j++) {
+            if (maskColumn[j] & (1 << i)) {
+                str << vpcCommands[j]->Parameters.find(binaryParams[i])->second;
+            }
+        }
+    }
+    for (std::size_t j = 0; j < vpcCommands.size(); j++) {
+        if (!(maskColumn[j] & binaryExtraParams)) {
+            continue;
+        }
+        const auto& params = vpcCommands[j]->Parameters;
+        std::vector<std::pair<const std::string*, double>> extras;
+        for (const auto& param : params) {
+            if (std::find(binaryParams.begin(), binaryParams.end(), param.first)
+                == binaryParams.end()) {
+                extras.emplace_back(&param.first, param.second);
+            }
+        }
+        str << (uint32_t)extras.size();
+        for (const auto& extra : extras) {
+            writeString(str, out, *extra.first);
+            str << extra.second;
+        }
+    }
 }
 
 void Toolpath::Restore(XMLReader& reader)
@@ -517,11 +683,91 @@ void Toolpath::Restore(XMLReader& reader)
 
 void Toolpath::RestoreDocFile(Base::Reader& reader)
 {
-    std::string gcode;
-    std::string line;
-    while (reader >> line) {
-        gcode += line;
-        gcode += " ";
+    // files of schema version 2 and older hold G-code text
+    const std::string fileName = reader.getFileName();
+    if (fileName.size() < 3 || fileName.compare(fileName.size() - 3, 3, ".nc") == 0) {
+        std::string gcode;
+        std::string line;
+        while (reader >> line) {
+            gcode += line;
+            gcode += " ";
+        }
+        setFromGCode(gcode);
+        return;
+    }
+
+    clear();
+    Base::InputStream str(reader);
+    uint32_t magic = 0;
+    uint32_t count = 0;
+    str >> magic >> count;
+    if (magic != binaryMagic) {
+        throw Base::FileException("Unknown path file format", fileName.c_str());
     }
-    setFromGCode(gcode);
+
+    uint32_t nameCount = 0;
+    str >> nameCount;
+    // every name is used by at least one command
+    if (!reader || nameCount > count) {
+        throw Base::FileException("Invalid path file", fileName.c_str());
+    }
+    std::vector<std::string> names;
+    names.reserve(std::min<uint32_t>(nameCount, 1 << 16));
+    for (uint32_t i = 0; i < nameCount; i++) {
+        names.push_back(readString(str, reader));
+    }
+
+    // the count is not trusted until the commands have actually been read
+    std::vector<Command*> commands;
+    commands.reserve(std::min<uint32_t>(count, 1 << 16));
+    try {
+        for (uint32_t j = 0; j < count; j++) {
+            uint32_t index = 0;
+            str >> index;
+            if (!reader || index >= names.size()) {
+                throw Base::FileException("Invalid path file", fileName.c_str());
+            }
+            commands.push_back(new Command());
+            commands.back()->Name = names[index];
+        }
+        std::vector<uint16_t> maskColumn(count);
+        for (uint16_t& mask : maskColumn) {
+            str >> mask;
+        }
+        for (std::size_t i = 0; i < binaryParams.size(); i++) {
+            std::string key(binaryParams[i]);
+            for (uint32_t j = 0; j < count; j++) {
+                if (maskColumn[j] & (1 << i)) {
+                    double value = 0;
+                    str >> value;
+                    commands[j]->Parameters.emplace(key, value);
+                }
+            }
+        }
+        for (uint32_t j = 0; j < count; j++) {
+            if (!(maskColumn[j] & binaryExtraParams)) {
+                continue;
+            }
+            uint32_t extras = 0;
+            str >> extras;
+            for (uint32_t k = 0; k < extras; k++) {
+                std::string key = readString(str, reader);
+                double value = 0;
+                str >> value;
+                commands[j]->Parameters.emplace(std::move(key), value);
+            }
+        }
+        if (!reader) {
+            throw Base::FileException("Unexpected end of path file", fileName.c_str());
+        }
+    }
+    catch (...) {
+        for (Command* cmd : commands) {
+            delete cmd;
+        }
+        throw;
+    }
+
+    vpcCommands = std::move(commands);
+    recalculate();
 }
@@ -87,7 +87,7 @@ public:
     }
     void setCenter(const Base::Vector3d& c);
 
-    static const int SchemaVersion = 2;
+    static const int SchemaVersion = 3;
 
 protected:
     std::vector<Command*> vpcCommands;
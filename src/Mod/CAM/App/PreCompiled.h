@@ -43,9 +43,19 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <charconv>
 #include <cinttypes>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <functional>
 #include <iomanip>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -112,7 +112,7 @@ void PropertyPath::Restore(Base::XMLReader& reader)
 
     if (reader.hasAttribute("version")) {
         int version = reader.getAttributeAsInteger("version");
-        if (version >= Toolpath::SchemaVersion) {
+        if (version >= 2) {
             reader.readElement("Center");
             double x = reader.getAttributeAsFloat("x");
             double y = reader.getAttributeAsFloat("y");
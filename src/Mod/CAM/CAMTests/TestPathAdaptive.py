@@ -24,6 +24,7 @@
 
 import FreeCAD
 import Part
+import area
 import Path.Op.Adaptive as PathAdaptive
 import Path.Main.Job as PathJob
 from CAMTests.PathTestUtils import PathTestBase
@@ -396,6 +397,31 @@ class TestPathAdaptive(PathTestBase):
                 break
         self.assertTrue(isInBox, "No paths originating within the inner hole.")
 
+    def test08(self):
+        """test08() Verify regions cleared concurrently give the same paths as serial clearing."""
+
+        def square(x, y, size):
+            return [(x, y), (x + size, y), (x + size, y + size), (x, y + size)]
+
+        paths = [square(i * 12.0, j * 12.0, 10.0) for i in range(3) for j in range(2)]
+        stock = [square(-2.0, -2.0, 38.0)]
+
+        def execute(threads):
+            a2d = area.Adaptive2d()
+            a2d.toolDiameter = 2.0
+            a2d.stepOverFactor = 0.3
+            a2d.tolerance = 0.1
+            a2d.threads = threads
+            results = a2d.Execute(stock, paths, lambda tp: False)
+            return [
+                (r.HelixCenterPoint, r.StartPoint, r.AdaptivePaths, r.ReturnMotionType)
+                for r in results
+            ]
+
+        serial = execute(1)
+        self.assertEqual(len(serial), len(paths), "Not every region cleared.")
+        self.assertEqual(execute(4), serial, "Concurrent clearing changed the paths.")
+
 
 # Eclass
 
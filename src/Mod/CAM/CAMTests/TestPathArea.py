@@ -0,0 +1,76 @@
+# -*- coding: utf-8 -*-
+# ***************************************************************************
+# *   Copyright (c) 2026 FreeCAD Project Association                        *
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+import FreeCAD
+import Part
+import Path
+from CAMTests.PathTestUtils import PathTestBase
+
+
+class TestPathArea(PathTestBase):
+    """Unit tests for Path.Area sections."""
+
+    def makeSections(self, shape, parallel):
+        area = Path.Area()
+        area.setPlane(Part.makeCircle(10))
+        area.add(shape)
+        area.setParams(
+            Offset=-1.0,
+            SectionCount=-1,
+            Stepdown=1.5,
+            SectionTolerance=1e-4,
+            SectionParallel=parallel,
+        )
+        return area.Sections
+
+    def assertWiresMatch(self, sections, reference):
+        self.assertEqual(len(sections), len(reference))
+        for section, expected in zip(sections, reference):
+            self.assertEqual(len(section.Wires), len(expected.Wires))
+            for wire, wireExpected in zip(section.Wires, expected.Wires):
+                self.assertEqual(len(wire.Edges), len(wireExpected.Edges))
+                self.assertRoughly(wire.Length, wireExpected.Length)
+                bb, bbExpected = wire.BoundBox, wireExpected.BoundBox
+                self.assertCoincide(
+                    FreeCAD.Vector(bb.XMin, bb.YMin, bb.ZMin),
+                    FreeCAD.Vector(bbExpected.XMin, bbExpected.YMin, bbExpected.ZMin),
+                )
+                self.assertCoincide(
+                    FreeCAD.Vector(bb.XMax, bb.YMax, bb.ZMax),
+                    FreeCAD.Vector(bbExpected.XMax, bbExpected.YMax, bbExpected.ZMax),
+                )
+                for vertex, vertexExpected in zip(wire.Vertexes, wireExpected.Vertexes):
+                    self.assertCoincide(vertex.Point, vertexExpected.Point)
+
+    def test00(self):
+        """Check that parallel sections match the sections made in order"""
+        # a box with a hole below a cylindrical boss, so the sections differ by height
+        box = Part.makeBox(20, 20, 6)
+        hole = Part.makeCylinder(3, 6, FreeCAD.Vector(6, 6, 0))
+        boss = Part.makeCylinder(5, 6, FreeCAD.Vector(12, 12, 6))
+        shape = box.cut(hole).fuse(boss)
+
+        serial = self.makeSections(shape, False)
+        parallel = self.makeSections(shape, True)
+
+        self.assertGreater(len(serial), 2)
+        self.assertWiresMatch(parallel, serial)
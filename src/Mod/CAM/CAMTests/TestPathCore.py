@@ -21,7 +21,9 @@
 # ***************************************************************************
 
 import FreeCAD
+import os
 import Path
+import tempfile
 from CAMTests.PathTestUtils import PathTestBase
 
 
@@ -134,3 +136,62 @@ G0 Z0.500000
         path = Path.Path(commands)
 
         self.assertEqual(path.Length, 2)
+
+    def saveAndRestore(self, commands, binary):
+        param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/CAM")
+        previous = param.GetBool("BinaryPathFile", False)
+        param.SetBool("BinaryPathFile", binary)
+        try:
+            doc = FreeCAD.newDocument("TestPathCoreSave")
+            obj = doc.addObject("Path::Feature", "Path")
+            obj.Path = Path.Path(commands)
+            fileName = os.path.join(tempfile.mkdtemp(), "TestPathCoreSave.FCStd")
+            doc.saveAs(fileName)
+            FreeCAD.closeDocument(doc.Name)
+        finally:
+            param.SetBool("BinaryPathFile", previous)
+
+        doc = FreeCAD.openDocument(fileName)
+        restored = doc.getObject("Path").Path.Commands
+        FreeCAD.closeDocument(doc.Name)
+        os.remove(fileName)
+        return restored
+
+    def test60(self):
+        """Test Path save and restore through a document"""
+        commands = []
+        commands.append(Path.Command("(comment)"))
+        commands.append(Path.Command("G0", {"X": 1.0 / 3, "Y": -2, "Z": 5}))
+        commands.append(Path.Command("G2", {"X": 2, "I": 0.5, "J": 0.25, "F": 100}))
+        commands.append(Path.Command("G83", {"Z": -1, "R": 1, "Q": 0.5}))
+        commands.append(Path.Command("M3", {"S": 3000}))
+
+        # the default G-code text file rounds the parameters
+        restored = self.saveAndRestore(commands, False)
+        self.assertEqual(len(restored), len(commands))
+        for cmd, other in zip(commands, restored):
+            self.assertEqual(cmd.Name, other.Name)
+            self.assertEqual(sorted(cmd.Parameters), sorted(other.Parameters))
+            for key, value in cmd.Parameters.items():
+                self.assertRoughly(value, other.Parameters[key])
+
+        # parameters are restored exactly from the binary file
+        restored = self.saveAndRestore(commands, True)
+        self.assertEqual(len(restored), len(commands))
+        for cmd, other in zip(commands, restored):
+            self.assertEqual(cmd.Name, other.Name)
+            self.assertEqual(cmd.Parameters, other.Parameters)
+
+    def test70(self):
+        """Test G-code round trip of a path larger than one parse chunk"""
+        lines = []
+        for i in range(1, 10001):
+            lines.append("G1 X%.6f Y-%.6f Z0.500000" % (i * 0.25, i * 0.125))
+            if i % 1000 == 0:
+                lines.append("(pass %d)" % i)
+        gcode = "\n".join(lines) + "\n"
+
+        p = Path.Path()
+        p.setFromGCode(gcode)
+        self.assertEqual(p.Size, len(lines))
+        self.assertEqual(p.toGCode(), gcode)
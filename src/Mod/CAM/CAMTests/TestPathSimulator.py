@@ -0,0 +1,71 @@
+# -*- coding: utf-8 -*-
+# ***************************************************************************
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+import FreeCAD
+import Part
+import Path
+import PathSimulator
+from CAMTests.PathTestUtils import PathTestBase
+
+
+class TestPathSimulator(PathTestBase):
+    """Test the headless stock simulation of PathSimulator.PathSim."""
+
+    def setUp(self):
+        self.sim = PathSimulator.PathSim()
+        self.sim.BeginSimulation(Part.makeBox(10, 10, 5), 0.5)
+        self.sim.SetToolShape(Part.makeCylinder(1, 5), 0.5)
+        self.start = FreeCAD.Placement(FreeCAD.Vector(0, 5, 10), FreeCAD.Rotation())
+
+    def test00(self):
+        """Verify a straight cut lowers the stock only along the tool path."""
+        commands = [
+            Path.Command("G0", {"X": 0, "Y": 5, "Z": 3}),
+            Path.Command("G1", {"X": 10}),
+        ]
+        end = self.sim.ApplyCommands(self.start, commands)
+        self.assertCoincide(end.Base, FreeCAD.Vector(10, 5, 3))
+
+        heights = self.sim.GetHeightMap()
+        self.assertEqual(len(heights), 21)
+        self.assertEqual(len(heights[0]), 21)
+        for x in range(21):
+            self.assertRoughly(heights[10][x], 3)
+            self.assertRoughly(heights[0][x], 5)
+            self.assertRoughly(heights[20][x], 5)
+
+    def test01(self):
+        """Verify a path gives the same result as its list of commands."""
+        commands = [
+            Path.Command("G0", {"X": 2, "Y": 5, "Z": 4}),
+            Path.Command("G2", {"X": 8, "Y": 5, "I": 3, "J": 0}),
+        ]
+        self.sim.ApplyCommands(self.start, Path.Path(commands))
+        heights = self.sim.GetHeightMap()
+
+        other = PathSimulator.PathSim()
+        other.BeginSimulation(Part.makeBox(10, 10, 5), 0.5)
+        other.SetToolShape(Part.makeCylinder(1, 5), 0.5)
+        other.ApplyCommands(self.start, commands)
+        self.assertEqual(heights, other.GetHeightMap())
+
+        # the clockwise arc passes over the top of its center only
+        self.assertRoughly(heights[16][10], 4)
+        self.assertRoughly(heights[4][10], 5)
@@ -44,6 +44,7 @@ class AdvancedPreferencesPage:
             self.form.WarningSuppressSelectionMode.isChecked(),
             self.form.WarningSuppressOpenCamLib.isChecked(),
             self.form.WarningSuppressVelocity.isChecked(),
+            self.form.BinaryPathFile.isChecked(),
         )
 
     def loadSettings(self):
@@ -60,6 +61,7 @@ class AdvancedPreferencesPage:
         )
         self.form.WarningSuppressOpenCamLib.setChecked(Path.Preferences.suppressOpenCamLibWarning())
         self.form.WarningSuppressVelocity.setChecked(Path.Preferences.suppressVelocity())
+        self.form.BinaryPathFile.setChecked(Path.Preferences.binaryPathFile())
         self.updateSelection()
 
     def updateSelection(self, state=None):
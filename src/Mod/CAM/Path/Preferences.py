@@ -68,6 +68,9 @@ WarningSuppressVelocity = "WarningSuppressVelocity"
 EnableExperimentalFeatures = "EnableExperimentalFeatures"
 EnableAdvancedOCLFeatures = "EnableAdvancedOCLFeatures"
 
+# Save the commands of paths in a binary file instead of G-code text
+BinaryPathFile = "BinaryPathFile"
+
 
 def preferences():
     return FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/CAM")
@@ -277,13 +280,20 @@ def suppressVelocity():
     return preferences().GetBool(WarningSuppressVelocity, False)
 
 
-def setPreferencesAdvanced(ocl, warnSpeeds, warnRapids, warnModes, warnOCL, warnVelocity):
+def binaryPathFile():
+    return preferences().GetBool(BinaryPathFile, False)
+
+
+def setPreferencesAdvanced(
+    ocl, warnSpeeds, warnRapids, warnModes, warnOCL, warnVelocity, binaryFile=False
+):
     preferences().SetBool(EnableAdvancedOCLFeatures, ocl)
     preferences().SetBool(WarningSuppressAllSpeeds, warnSpeeds)
     preferences().SetBool(WarningSuppressRapidSpeeds, warnRapids)
     preferences().SetBool(WarningSuppressSelectionMode, warnModes)
     preferences().SetBool(WarningSuppressOpenCamLib, warnOCL)
     preferences().SetBool(WarningSuppressVelocity, warnVelocity)
+    preferences().SetBool(BinaryPathFile, binaryFile)
 
 
 def lastFileToolLibrary():
@@ -21,6 +21,9 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <cmath>
+#endif
 
 #include "PathSim.h"
 
@@ -79,3 +82,78 @@ Base::Placement* PathSim::ApplyCommand(Base::Placement* pos, Command* cmd)
     plc->setPosition(vec);
     return plc;
 }
+
+// Split an arc move into linear moves whose chords stay within a quarter of the
+// simulation resolution. The center is relative to the start point, as in G-code.
+static void addArcMoves(std::vector<cSimMove>& moves,
+                        const Point3D& fromPos,
+                        const Point3D& toPos,
+                        const Point3D& cent,
+                        bool isCCW,
+                        float resolution)
+{
+    double cx = fromPos.x + cent.x;
+    double cy = fromPos.y + cent.y;
+    double rad = std::sqrt(cent.x * cent.x + cent.y * cent.y);
+    if (rad < SIM_EPSILON) {
+        moves.emplace_back(fromPos, toPos);
+        return;
+    }
+    double sang = atan2(fromPos.y - cy, fromPos.x - cx);
+    double ang = atan2(toPos.y - cy, toPos.x - cx) - sang;
+    if (!isCCW && ang >= 0) {
+        ang -= 2 * M_PI;
+    }
+    if (isCCW && ang <= 0) {
+        ang += 2 * M_PI;
+    }
+
+    double tolerance = resolution / 4;
+    double step = M_PI / 4;
+    if (tolerance < rad) {
+        step = std::min(step, 2 * acos(1 - tolerance / rad));
+    }
+    int ndivs = std::max(1, (int)std::ceil(std::fabs(ang) / step));
+    Point3D last = fromPos;
+    for (int i = 1; i < ndivs; i++) {
+        double a = sang + ang * i / ndivs;
+        Point3D next(cx + rad * cos(a),
+                     cy + rad * sin(a),
+                     fromPos.z + (toPos.z - fromPos.z) * i / ndivs);
+        moves.emplace_back(last, next);
+        last = next;
+    }
+    moves.emplace_back(last, toPos);
+}
+
+Base::Placement* PathSim::ApplyCommands(Base::Placement* pos, const std::vector<Command*>& cmds)
+{
+    if (!m_stock) {
+        throw Base::RuntimeError("Path Simulation: Simulation has no stock object");
+    }
+
+    Point3D fromPos(*pos);
+    std::vector<cSimMove> moves;
+    moves.reserve(cmds.size());
+    for (Command* cmd : cmds) {
+        Point3D toPos(fromPos);
+        toPos.UpdateCmd(*cmd);
+        if (cmd->Name == "G0" || cmd->Name == "G1") {
+            moves.emplace_back(fromPos, toPos);
+        }
+        else if (cmd->Name == "G2" || cmd->Name == "G3") {
+            Vector3d vcent = cmd->getCenter();
+            Point3D cent(vcent);
+            addArcMoves(moves, fromPos, toPos, cent, cmd->Name == "G3", m_stock->GetResolution());
+        }
+        fromPos = toPos;
+    }
+    if (m_tool) {
+        m_stock->ApplyMoves(moves, *m_tool);
+    }
+
+    Base::Placement* plc = new Base::Placement();
+    Vector3d vec(fromPos.x, fromPos.y, fromPos.z);
+    plc->setPosition(vec);
+    return plc;
+}
@@ -24,6 +24,7 @@
 #define PATHSIMULATOR_PathSim_H
 
 #include <memory>
+#include <vector>
 #include <TopoDS_Shape.hxx>
 
 #include <Mod/CAM/App/Command.h>
@@ -51,6 +52,7 @@ public:
     void BeginSimulation(Part::TopoShape* stock, float resolution);
     void SetToolShape(const TopoDS_Shape& toolShape, float resolution);
     Base::Placement* ApplyCommand(Base::Placement* pos, Command* cmd);
+    Base::Placement* ApplyCommands(Base::Placement* pos, const std::vector<Command*>& cmds);
 
 public:
     std::unique_ptr<cStock> m_stock;
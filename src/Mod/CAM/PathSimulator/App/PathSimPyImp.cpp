@@ -27,6 +27,7 @@
 
 #include <Mod/Mesh/App/MeshPy.h>
 #include <Mod/CAM/App/CommandPy.h>
+#include <Mod/CAM/App/PathPy.h>
 #include <Mod/Part/App/TopoShapePy.h>
 
 #include "PathSim.h"
@@ -140,6 +141,73 @@ PyObject* PathSimPy::ApplyCommand(PyObject* args, PyObject* kwds)
     return newposPy;
 }
 
+PyObject* PathSimPy::ApplyCommands(PyObject* args, PyObject* kwds)
+{
+    static const std::array<const char*, 3> kwlist {"position", "commands", nullptr};
+    PyObject* pObjPlace;
+    PyObject* pObjCmds;
+    if (!Base::Wrapped_ParseTupleAndKeywords(args,
+                                             kwds,
+                                             "O!O",
+                                             kwlist,
+                                             &(Base::PlacementPy::Type),
+                                             &pObjPlace,
+                                             &pObjCmds)) {
+        return nullptr;
+    }
+
+    std::vector<Path::Command*> cmds;
+    if (PyObject_TypeCheck(pObjCmds, &(Path::PathPy::Type))) {
+        cmds = static_cast<Path::PathPy*>(pObjCmds)->getToolpathPtr()->getCommands();
+    }
+    else if (PySequence_Check(pObjCmds)) {
+        Py::Sequence sequence(pObjCmds);
+        for (Py::Sequence::iterator it = sequence.begin(); it != sequence.end(); ++it) {
+            PyObject* pObjCmd = (*it).ptr();
+            if (!PyObject_TypeCheck(pObjCmd, &(Path::CommandPy::Type))) {
+                PyErr_SetString(PyExc_TypeError, "The list must contain only Path Commands");
+                return nullptr;
+            }
+            cmds.push_back(static_cast<Path::CommandPy*>(pObjCmd)->getCommandPtr());
+        }
+    }
+    else {
+        PyErr_SetString(PyExc_TypeError, "Expected a Path or a list of Path Commands");
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        PathSim* sim = getPathSimPtr();
+        Base::Placement* pos = static_cast<Base::PlacementPy*>(pObjPlace)->getPlacementPtr();
+        Base::Placement* newpos = sim->ApplyCommands(pos, cmds);
+        return new Base::PlacementPy(newpos);
+    }
+    PY_CATCH
+}
+
+PyObject* PathSimPy::GetHeightMap(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    cStock* stock = getPathSimPtr()->m_stock.get();
+    if (!stock) {
+        PyErr_SetString(PyExc_RuntimeError, "Simulation has no stock object");
+        return nullptr;
+    }
+
+    Py::List rows;
+    for (int y = 0; y < stock->GetSizeY(); y++) {
+        Py::List row;
+        for (int x = 0; x < stock->GetSizeX(); x++) {
+            row.append(Py::Float(stock->GetHeight(x, y)));
+        }
+        rows.append(row);
+    }
+    return Py::new_reference_to(rows);
+}
+
 Py::Object PathSimPy::getTool() const
 {
     // return Py::Object();
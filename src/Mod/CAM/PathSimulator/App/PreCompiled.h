@@ -30,11 +30,13 @@
 // standard
 #include <cstdio>
 #include <cassert>
+#include <cmath>
 #include <iostream>
 
 // STL
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <map>
 #include <queue>
@@ -23,6 +23,8 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #endif
 
 #include <BRepBndLib.hxx>
@@ -30,6 +32,8 @@
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <gp_Pnt.hxx>
 
+#include <Base/Parallel.h>
+
 #include "VolSim.h"
 
 
@@ -663,6 +667,180 @@ void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool
     }
 }
 
+// Tool profile sampled at a fixed sub-pixel step, so that cutting a pixel costs a table
+// lookup rather than a search in the tool shape.
+struct cStock::cProfile
+{
+    cProfile(cSimTool& tool, float res)
+    {
+        radius = tool.radius / res;
+        int samples = std::max(1, (int)std::ceil(radius * 4));
+        scale = samples / std::max(radius, (float)SIM_EPSILON);
+        heights.resize(samples + 1);
+        for (int i = 0; i <= samples; i++) {
+            heights[i] = tool.GetToolProfileAt((float)i / samples);
+        }
+    }
+
+    // height of the tool profile at the given distance from its axis, in pixels
+    inline float At(float dist) const
+    {
+        return heights[std::min((int)(dist * scale + 0.5f), (int)heights.size() - 1)];
+    }
+
+    float radius;  // tool radius in pixels
+    float scale;
+    std::vector<float> heights;
+};
+
+void cStock::CutMove(const cSimMove& move,
+                     const cProfile& profile,
+                     int tx0,
+                     int ty0,
+                     int tx1,
+                     int ty1)
+{
+    const Point3D& p1 = move.pStart;
+    const Point3D& p2 = move.pEnd;
+    float rad = profile.radius;
+    float dx = p2.x - p1.x;
+    float dy = p2.y - p1.y;
+    float dz = p2.z - p1.z;
+    float len2 = dx * dx + dy * dy;
+    float len = std::sqrt(len2);
+    bool plunge = len < SIM_EPSILON;
+
+    // y range of the pixel centers of column x inside the area swept by the tool,
+    // i.e. the union of the end circles and the band between them
+    auto circleRange = [&](const Point3D& p, float x, float& lo, float& hi) {
+        float ox = x - p.x;
+        float h2 = rad * rad - ox * ox;
+        if (h2 >= 0) {
+            float h = std::sqrt(h2);
+            lo = std::min(lo, p.y - h);
+            hi = std::max(hi, p.y + h);
+        }
+    };
+    // y range where ax * x + ay * y is within [vlo, vhi]
+    auto slabRange = [](float ax, float ay, float vlo, float vhi, float x, float& lo, float& hi) {
+        float v = ax * x;
+        if (std::fabs(ay) < SIM_EPSILON) {
+            if (v < vlo || v > vhi) {
+                hi = lo - 1;
+            }
+            return;
+        }
+        float y1 = (vlo - v) / ay;
+        float y2 = (vhi - v) / ay;
+        lo = std::max(lo, std::min(y1, y2));
+        hi = std::min(hi, std::max(y1, y2));
+    };
+
+    float ux = plunge ? 0 : dx / len;
+    float uy = plunge ? 0 : dy / len;
+    float along = ux * p1.x + uy * p1.y;
+    float across = -uy * p1.x + ux * p1.y;
+    float zPlunge = std::min(p1.z, p2.z);
+
+    int xs = std::max(tx0, (int)std::floor(std::min(p1.x, p2.x) - rad));
+    int xe = std::min(tx1 - 1, (int)std::floor(std::max(p1.x, p2.x) + rad));
+    for (int x = xs; x <= xe; x++) {
+        float xc = x + 0.5f;
+        float lo = std::numeric_limits<float>::max();
+        float hi = std::numeric_limits<float>::lowest();
+        circleRange(p2, xc, lo, hi);
+        if (!plunge) {
+            circleRange(p1, xc, lo, hi);
+            float blo = std::numeric_limits<float>::lowest();
+            float bhi = std::numeric_limits<float>::max();
+            slabRange(ux, uy, along, along + len, xc, blo, bhi);
+            slabRange(-uy, ux, across - rad, across + rad, xc, blo, bhi);
+            if (blo <= bhi) {
+                lo = std::min(lo, blo);
+                hi = std::max(hi, bhi);
+            }
+        }
+        int ys = std::max(ty0, (int)std::ceil(lo - 0.5f));
+        int ye = std::min(ty1 - 1, (int)std::floor(hi - 0.5f));
+
+        float* column = m_stock[x];
+        float wx = xc - p1.x;
+        for (int y = ys; y <= ye; y++) {
+            float wy = y + 0.5f - p1.y;
+            float z;
+            float dist2;
+            if (plunge) {
+                z = zPlunge;
+                dist2 = (xc - p2.x) * (xc - p2.x) + (y + 0.5f - p2.y) * (y + 0.5f - p2.y);
+            }
+            else {
+                float t = std::clamp((wx * dx + wy * dy) / len2, 0.0f, 1.0f);
+                float ox = wx - t * dx;
+                float oy = wy - t * dy;
+                z = p1.z + t * dz;
+                dist2 = ox * ox + oy * oy;
+            }
+            column[y] = std::min(column[y], z + profile.At(std::sqrt(dist2)));
+        }
+    }
+}
+
+void cStock::ApplyMoves(const std::vector<cSimMove>& moves, cSimTool& tool)
+{
+    // translate coordinates
+    std::vector<cSimMove> innerMoves;
+    innerMoves.reserve(moves.size());
+    for (const auto& move : moves) {
+        Point3D p1 = move.pStart;
+        Point3D p2 = move.pEnd;
+        innerMoves.emplace_back(ToInner(p1), ToInner(p2));
+    }
+    cProfile profile(tool, m_res);
+    int rad = (int)std::ceil(profile.radius);
+
+    // collect the moves touching each tile, keeping their order
+    int tilesX = (m_x + SIM_TILE_SIZE - 1) / SIM_TILE_SIZE;
+    int tilesY = (m_y + SIM_TILE_SIZE - 1) / SIM_TILE_SIZE;
+    std::vector<std::vector<int>> tileMoves(tilesX * tilesY);
+    for (int i = 0; i < (int)innerMoves.size(); i++) {
+        const cSimMove& move = innerMoves[i];
+        int xs = (int)std::floor(std::min(move.pStart.x, move.pEnd.x)) - rad;
+        int xe = (int)std::floor(std::max(move.pStart.x, move.pEnd.x)) + rad;
+        int ys = (int)std::floor(std::min(move.pStart.y, move.pEnd.y)) - rad;
+        int ye = (int)std::floor(std::max(move.pStart.y, move.pEnd.y)) + rad;
+        if (xe < 0 || ye < 0 || xs >= m_x || ys >= m_y) {
+            continue;
+        }
+        xs = std::max(0, xs) / SIM_TILE_SIZE;
+        xe = std::min(m_x - 1, xe) / SIM_TILE_SIZE;
+        ys = std::max(0, ys) / SIM_TILE_SIZE;
+        ye = std::min(m_y - 1, ye) / SIM_TILE_SIZE;
+        for (int tx = xs; tx <= xe; tx++) {
+            for (int ty = ys; ty <= ye; ty++) {
+                tileMoves[tx * tilesY + ty].push_back(i);
+            }
+        }
+    }
+    std::vector<int> tiles;
+    for (int i = 0; i < (int)tileMoves.size(); i++) {
+        if (!tileMoves[i].empty()) {
+            tiles.push_back(i);
+        }
+    }
+
+    // tiles do not share any pixel, so they can be cut concurrently
+    Base::parallelFor(tiles.size(), [&](std::size_t i) {
+        int tile = tiles[i];
+        int tx0 = (tile / tilesY) * SIM_TILE_SIZE;
+        int ty0 = (tile % tilesY) * SIM_TILE_SIZE;
+        int tx1 = std::min(m_x, tx0 + SIM_TILE_SIZE);
+        int ty1 = std::min(m_y, ty0 + SIM_TILE_SIZE);
+        for (int move : tileMoves[tile]) {
+            CutMove(innerMoves[move], profile, tx0, ty0, tx1, ty1);
+        }
+    });
+}
+
 
 //************************************************************************************************************
 // Line Segment
@@ -36,6 +36,7 @@
 #define SIM_TESSEL_BOT 2
 #define SIM_WALK_RES                                                                               \
     0.6  // step size in pixel units (to make sure all pixels in the path are visited)
+#define SIM_TILE_SIZE 64  // stock tile size in pixel units for parallel material removal
 
 struct toolShapePoint
 {
@@ -169,6 +170,16 @@ struct cLineSegment
     float lenXY;
 };
 
+struct cSimMove
+{
+    cSimMove(const Point3D& p1, const Point3D& p2)
+        : pStart(p1)
+        , pEnd(p2)
+    {}
+    Point3D pStart;
+    Point3D pEnd;
+};
+
 class cSimTool
 {
 public:
@@ -227,12 +238,34 @@ public:
     void CreatePocket(float x, float y, float rad, float height);
     void ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool);
     void ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool& tool, bool isCCW);
+    /* Apply a batch of linear moves, cutting every pixel swept by the tool once per move.
+       The stock is split into tiles that are updated concurrently, each from the moves
+       touching it. */
+    void ApplyMoves(const std::vector<cSimMove>& moves, cSimTool& tool);
     inline Point3D ToInner(Point3D& p)
     {
         return Point3D((p.x - m_px) / m_res, (p.y - m_py) / m_res, p.z);
     }
+    inline float GetHeight(int x, int y)
+    {
+        return m_stock[x][y];
+    }
+    inline int GetSizeX() const
+    {
+        return m_x;
+    }
+    inline int GetSizeY() const
+    {
+        return m_y;
+    }
+    inline float GetResolution() const
+    {
+        return m_res;
+    }
 
 private:
+    struct cProfile;
+    void CutMove(const cSimMove& move, const cProfile& profile, int tx0, int ty0, int tx1, int ty1);
     float FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
     void FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
     void SetFacetPoints(MeshCore::MeshGeomFacet& facet, Point3D& p1, Point3D& p2, Point3D& p3);
@@ -26,6 +26,23 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#endif
 
 namespace ClipperLib
 {
@@ -1157,7 +1174,10 @@ public:
 
     double getRandomAngle()
     {
-        return MIN_ANGLE + (MAX_ANGLE - MIN_ANGLE) * double(rand()) / double(RAND_MAX);
+        // own generator, so that the regions processed concurrently get the same angles
+        return MIN_ANGLE
+            + (MAX_ANGLE - MIN_ANGLE) * double(random() - random.min())
+            / double(random.max() - random.min());
     }
     size_t getPointCount()
     {
@@ -1167,6 +1187,7 @@ public:
 private:
     vector<double> angles;
     vector<double> areas;
+    std::minstd_rand random;
 };
 
 //***************************************
@@ -1386,6 +1407,31 @@ private:
     }
 };
 
+// CPU time in seconds used by the calling thread. Unlike clock(), it is not consumed by the
+// other threads processing regions concurrently.
+double ThreadCpuTime()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+        return double(clock()) / CLOCKS_PER_SEC;
+    }
+    ULARGE_INTEGER ticks;  // 100ns units
+    ticks.LowPart = user.dwLowDateTime;
+    ticks.HighPart = user.dwHighDateTime;
+    ULARGE_INTEGER kernelTicks;
+    kernelTicks.LowPart = kernel.dwLowDateTime;
+    kernelTicks.HighPart = kernel.dwHighDateTime;
+    return double(ticks.QuadPart + kernelTicks.QuadPart) * 1e-7;
+#else
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+        return double(clock()) / CLOCKS_PER_SEC;
+    }
+    return double(ts.tv_sec) + double(ts.tv_nsec) * 1e-9;
+#endif
+}
+
 //***************************************
 // Adaptive2d main class - implementation
 //***************************************
@@ -1732,7 +1778,6 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths& stockPaths,
     }
     // scaleFactor = round(scaleFactor);
 
-    current_region = 0;
     cout << "Tool Diameter: " << toolDiameter << endl;
     cout << "Accuracy: " << round(10000.0 / scaleFactor) / 10 << " um" << endl;
     cout << flush;
@@ -1825,6 +1870,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths& stockPaths,
     //	Resolve hierarchy and run processing
     //***************************************
     double cornerRoundingOffset = 0.15 * toolRadiusScaled / 2;
+    std::vector<std::pair<Paths, Paths>> regions;  // bound paths and tool bound paths
     if (opType == OperationType::otClearingInside || opType == OperationType::otClearingOutside) {
 
         // prepare stock boundary overshooted paths
@@ -1876,7 +1922,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths& stockPaths,
                 clipof.Clear();
                 clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
                 clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
-                ProcessPolyNode(boundPaths, toolBoundPaths);
+                regions.emplace_back(std::move(boundPaths), std::move(toolBoundPaths));
             }
         }
     }
@@ -1933,14 +1979,112 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths& stockPaths,
                     clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
                     clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
 
-                    ProcessPolyNode(boundPaths, toolBoundPaths);
+                    regions.emplace_back(std::move(boundPaths), std::move(toolBoundPaths));
                 }
             }
         }
     }
+    ProcessRegions(regions);
     return results;
 }
 
+//********************************************
+// Adaptive2d - concurrent processing of regions
+//********************************************
+
+struct Adaptive2d::RegionProgress
+{
+    std::mutex mutex;
+    TPaths paths;  // progress paths waiting to be reported
+    std::atomic<bool> stop {false};
+};
+
+bool Adaptive2d::IsStopRequested() const
+{
+    return regionProgress ? regionProgress->stop.load() : stopProcessing;
+}
+
+void Adaptive2d::ProcessRegions(std::vector<std::pair<Paths, Paths>>& regions)
+{
+    size_t threadCount = threads > 0 ? size_t(threads) : std::thread::hardware_concurrency();
+#ifdef DEV_MODE
+    threadCount = 1;  // perf counters and debug drawing are not thread safe
+#endif
+    threadCount = min(threadCount, regions.size());
+    if (threadCount <= 1) {
+        for (size_t i = 0; i < regions.size(); i++) {
+            AdaptiveOutput output;
+            if (ProcessPolyNode(regions[i].first, regions[i].second, i + 1, output)) {
+                results.push_back(output);
+            }
+        }
+        return;
+    }
+
+    // Each region is cleared independently, so regions are processed by worker threads and their
+    // outputs appended in the original order. The progress callback may call into python, thus
+    // progress is collected from the workers and reported from this thread.
+    RegionProgress progress;
+    regionProgress = &progress;
+    std::vector<AdaptiveOutput> outputs(regions.size());
+    std::vector<char> hasOutput(regions.size(), 0);
+    std::atomic<size_t> next {0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < regions.size(); i = next++) {
+            try {
+                hasOutput[i] =
+                    ProcessPolyNode(regions[i].first, regions[i].second, i + 1, outputs[i]);
+            }
+            catch (...) {
+                progress.stop = true;
+                throw;
+            }
+        }
+    };
+    std::vector<std::future<void>> futures;
+    for (size_t i = 0; i < threadCount; i++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+
+    auto reportProgress = [&]() {
+        TPaths paths;
+        {
+            std::lock_guard<std::mutex> lock(progress.mutex);
+            paths.swap(progress.paths);
+        }
+        if (!paths.empty() && progressCallback && (*progressCallback)(paths)) {
+            progress.stop = true;
+        }
+    };
+    auto interval = std::chrono::milliseconds(1000 * PROGRESS_TICKS / CLOCKS_PER_SEC);
+    std::exception_ptr error;
+    for (auto& future : futures) {
+        while (future.wait_for(interval) != std::future_status::ready) {
+            reportProgress();
+        }
+        try {
+            future.get();
+        }
+        catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    reportProgress();
+    stopProcessing = progress.stop;
+    regionProgress = NULL;
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    for (size_t i = 0; i < regions.size(); i++) {
+        if (hasOutput[i]) {
+            results.push_back(std::move(outputs[i]));
+        }
+    }
+}
+
 bool Adaptive2d::FindEntryPoint(TPaths& progressPaths,
                                 const Paths& toolBoundPaths,
                                 const Paths& boundPaths,
@@ -2211,15 +2355,15 @@ bool Adaptive2d::ResolveLinkPath(const IntPoint& startPoint,
     double par;
 
     // put a time limit on the resolving the link path
-    clock_t time_limit = (clock_t)(max(keepToolDownDistRatio, 3.0) * CLOCKS_PER_SEC / 6);
+    double time_limit = max(keepToolDownDistRatio, 3.0) / 6;
 
-    clock_t time_out = clock() + time_limit;
+    double time_out = ThreadCpuTime() + time_limit;
 
     while (!queue.empty()) {
-        if (stopProcessing) {
+        if (IsStopRequested()) {
             return false;
         }
-        if (clock() > time_out) {
+        if (ThreadCpuTime() > time_out) {
             cout << "Unable to resolve tool down linking path (limit reached)." << endl;
             return false;
         }
@@ -2285,7 +2429,7 @@ bool Adaptive2d::ResolveLinkPath(const IntPoint& startPoint,
             IntPoint midPoint(0.5 * double(pointPair.first.X + pointPair.second.X),
                               0.5 * double(pointPair.first.Y + pointPair.second.Y));
             for (long i = 1;; i++) {
-                if (stopProcessing) {
+                if (IsStopRequested()) {
                     return false;
                 }
                 double offset = i * scanStep;
@@ -2644,14 +2788,24 @@ void Adaptive2d::AppendToolPath(TPaths& progressPaths,
 
 void Adaptive2d::CheckReportProgress(TPaths& progressPaths, bool force)
 {
-    if (!force && (clock() - lastProgressTime < PROGRESS_TICKS)) {
+    // worker threads keep their own report interval
+    static thread_local clock_t lastRegionProgressTime = 0;
+    clock_t& lastTime = regionProgress ? lastRegionProgressTime : lastProgressTime;
+    if (!force && (clock() - lastTime < PROGRESS_TICKS)) {
         return;  // not yet
     }
-    lastProgressTime = clock();
+    lastTime = clock();
     if (progressPaths.empty()) {
         return;
     }
-    if (progressCallback) {
+    if (regionProgress) {
+        // hand over to the calling thread
+        std::lock_guard<std::mutex> lock(regionProgress->mutex);
+        regionProgress->paths.insert(regionProgress->paths.end(),
+                                     progressPaths.begin(),
+                                     progressPaths.end());
+    }
+    else if (progressCallback) {
         if ((*progressCallback)(progressPaths)) {
             stopProcessing = true;  // call python function, if returns true signal stop processing
         }
@@ -2701,11 +2855,13 @@ void Adaptive2d::AddPathToProgress(TPaths& progressPaths, const Path pth, Motion
     }
 }
 
-void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
+bool Adaptive2d::ProcessPolyNode(Paths boundPaths,
+                                 Paths toolBoundPaths,
+                                 size_t region,
+                                 AdaptiveOutput& output)
 {
     Perf_ProcessPolyNode.Start();
-    current_region++;
-    cout << "** Processing region: " << current_region << endl;
+    cout << "** Processing region: " << region << endl;
 
     // node paths are already constrained to tool boundary path for adaptive path before finishing
     // pass
@@ -2763,7 +2919,7 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
                             toolPos,
                             toolDir)) {
             Perf_ProcessPolyNode.Stop();
-            return;
+            return false;
         }
     }
 
@@ -2780,7 +2936,6 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
     // cout << "Entry point:" << double(entryPoint.X)/scaleFactor << "," <<
     // double(entryPoint.Y)/scaleFactor << endl;
 
-    AdaptiveOutput output;
     output.ReturnMotionType = 0;
     output.HelixCenterPoint.first = double(entryPoint.X) / scaleFactor;
     output.HelixCenterPoint.second = double(entryPoint.Y) / scaleFactor;
@@ -2827,7 +2982,7 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
     // LOOP - PASSES
     //*******************************
     for (long pass = 0; pass < PASSES_LIMIT; pass++) {
-        if (stopProcessing) {
+        if (IsStopRequested()) {
             break;
         }
 
@@ -2865,7 +3020,7 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
         // LOOP - POINTS
         //*******************************
         for (long point_index = 0; point_index < POINTS_PER_PASS_LIMIT; point_index++) {
-            if (stopProcessing) {
+            if (IsStopRequested()) {
                 break;
             }
 
@@ -3183,7 +3338,7 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
         Path finShiftedPath;
 
         bool allCutsAllowed = true;
-        while (!stopProcessing
+        while (!IsStopRequested()
                && PopPathWithClosestPoint(finishingPaths, lastPoint, finShiftedPath)) {
             if (finShiftedPath.empty()) {
                 continue;
@@ -3296,7 +3451,7 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
                  << "Hint: try to modify accuracy and/or step-over." << endl;
         }
     }
-    results.push_back(output);
+    return true;
 }
 
 }  // namespace AdaptivePath
@@ -97,6 +97,7 @@ public:
     bool finishingProfile = true;
     double keepToolDownDistRatio = 3.0;  // keep tool down distance ratio
     OperationType opType = OperationType::otClearingInside;
+    int threads = 0;  // max. number of regions processed concurrently, 0 - one per CPU core
 
     std::list<AdaptiveOutput> Execute(const DPaths& stockPaths,
                                       const DPaths& paths,
@@ -122,13 +123,21 @@ private:
     double referenceCutArea = 0;
     double optimalCutAreaPD = 0;
     bool stopProcessing = false;
-    int current_region = 0;
     clock_t lastProgressTime = 0;
 
     std::function<bool(TPaths)>* progressCallback = NULL;
     Path toolGeometry;  // tool geometry at coord 0,0, should not be modified
 
-    void ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths);
+    // progress of the regions processed by worker threads, reported from the calling thread
+    struct RegionProgress;
+    RegionProgress* regionProgress = NULL;
+
+    void ProcessRegions(std::vector<std::pair<Paths, Paths>>& regions);
+    bool ProcessPolyNode(Paths boundPaths,
+                         Paths toolBoundPaths,
+                         size_t region,
+                         AdaptiveOutput& output /*output*/);
+    bool IsStopRequested() const;
     bool FindEntryPoint(TPaths& progressPaths,
                         const Paths& toolBoundPaths,
                         const Paths& bound,
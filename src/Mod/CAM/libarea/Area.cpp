@@ -15,13 +15,13 @@ double CArea::m_clipper_clean_distance = 0.0;
 bool CArea::m_fit_arcs = true;
 int CArea::m_min_arc_points = 4;
 int CArea::m_max_arc_points = 100;
-double CArea::m_single_area_processing_length = 0.0;
-double CArea::m_processing_done = 0.0;
+thread_local double CArea::m_single_area_processing_length = 0.0;
+thread_local double CArea::m_processing_done = 0.0;
 bool CArea::m_please_abort = false;
-double CArea::m_MakeOffsets_increment = 0.0;
-double CArea::m_split_processing_length = 0.0;
-bool CArea::m_set_processing_length_in_split = false;
-double CArea::m_after_MakeOffsets_length = 0.0;
+thread_local double CArea::m_MakeOffsets_increment = 0.0;
+thread_local double CArea::m_split_processing_length = 0.0;
+thread_local bool CArea::m_set_processing_length_in_split = false;
+thread_local double CArea::m_after_MakeOffsets_length = 0.0;
 // static const double PI = 3.1415926535897932;
 
 #define _CAREA_PARAM_DEFINE(_class, _type, _name)                                                  \
@@ -55,12 +55,13 @@ public:
     static bool m_fit_arcs;
     static int m_min_arc_points;
     static int m_max_arc_points;
-    static double m_processing_done;  // 0.0 to 100.0, set inside MakeOnePocketCurve
-    static double m_single_area_processing_length;
-    static double m_after_MakeOffsets_length;
-    static double m_MakeOffsets_increment;
-    static double m_split_processing_length;
-    static bool m_set_processing_length_in_split;
+    // the progress of the pocket operations running on the calling thread
+    static thread_local double m_processing_done;  // 0.0 to 100.0, set inside MakeOnePocketCurve
+    static thread_local double m_single_area_processing_length;
+    static thread_local double m_after_MakeOffsets_length;
+    static thread_local double m_MakeOffsets_increment;
+    static thread_local double m_split_processing_length;
+    static thread_local bool m_set_processing_length_in_split;
     static bool m_please_abort;  // the user sets this from another thread, to tell
                                  // MakeOnePocketCurve to finish with no result.
     static double m_clipper_scale;
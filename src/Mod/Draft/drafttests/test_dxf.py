@@ -29,6 +29,7 @@
 ## \addtogroup drafttests
 # @{
 import os
+import tempfile
 import unittest
 
 import FreeCAD as App
@@ -87,6 +88,58 @@ class DraftDXF(unittest.TestCase):
         obj = Draft.export_dxf(out_file)
         self.assertTrue(obj, "'{}' failed".format(operation))
 
+    def test_read_dxf_inserts(self):
+        """Read a DXF file with CRLF lines, a BOM and rigid block inserts."""
+        operation = "Import.readDXF"
+        _msg("  Test '{}'".format(operation))
+
+        # a block with one line, inserted rotated at a '+'-prefixed
+        # coordinate and moved
+        records = ["0", "SECTION", "2", "BLOCKS",
+                   "0", "BLOCK", "8", "0", "2", "SQ", "70", "0",
+                   "10", "0.0", "20", "0.0", "30", "0.0", "3", "SQ",
+                   "0", "LINE", "8", "0",
+                   "10", "0.0", "20", "0.0", "30", "0.0",
+                   "11", "5.0", "21", "0.0", "31", "0.0",
+                   "0", "ENDBLK", "0", "ENDSEC",
+                   "0", "SECTION", "2", "ENTITIES",
+                   "0", "INSERT", "8", "0", "2", "SQ",
+                   "10", "+10.0", "20", "0.0", "30", "0.0", "50", "90.0",
+                   "0", "INSERT", "8", "0", "2", "SQ",
+                   "10", "0.0", "20", "20.0", "30", "0.0",
+                   "0", "ENDSEC", "0", "EOF"]
+        in_file = os.path.join(tempfile.gettempdir(), "test_dxf_inserts.dxf")
+        with open(in_file, "wb") as f:
+            f.write(b"\xef\xbb\xbf" + "\r\n".join(records).encode() + b"\r\n")
+        _msg("  file={}".format(in_file))
+
+        # create one shape object per entity
+        options = "User parameter:BaseApp/Preferences/Mod/Draft/TestDxfInserts"
+        param = App.ParamGet(options)
+        param.SetBool("groupLayers", False)
+        param.SetBool("dxfCreatePart", True)
+        param.SetBool("dxfUseDraftVisGroups", False)
+        try:
+            import Import
+            Import.readDXF(in_file, self.doc_name, True, options)
+        finally:
+            App.ParamGet("User parameter:BaseApp/Preferences/Mod/Draft").RemGroup(
+                "TestDxfInserts")
+            os.remove(in_file)
+
+        edges = []
+        for obj in self.doc.Objects:
+            if obj.isDerivedFrom("Part::Feature"):
+                edges.extend(obj.Shape.Edges)
+        self.assertEqual(len(edges), 2, "'{}' failed".format(operation))
+
+        # both inserts share the geometry of the block line
+        self.assertTrue(edges[0].isPartner(edges[1]))
+        points = sorted([tuple(round(c, 6) for c in (v.X, v.Y, v.Z))
+                         for e in edges for v in e.Vertexes])
+        self.assertEqual(points, [(0.0, 20.0, 0.0), (5.0, 20.0, 0.0),
+                                  (10.0, 0.0, 0.0), (10.0, 5.0, 0.0)])
+
     def tearDown(self):
         """Finish the test.
 
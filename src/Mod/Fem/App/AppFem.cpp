@@ -60,6 +60,7 @@
 #include "FemSetNodesObject.h"
 #include "FemSolverObject.h"
 #include "HypothesisPy.h"
+#include "PropertyResultField.h"
 
 #ifdef FC_USE_VTK
 #include "FemPostFilter.h"
@@ -168,6 +169,7 @@ PyMOD_INIT_FUNC(Fem)
     Fem::PropertyFemMesh                      ::init();
 
     Fem::FemResultObject                      ::init();
+    Fem::PropertyResultField                  ::init();
     Fem::FemResultObjectPython                ::init();
 
     Fem::FemSetObject                         ::init();
@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <cmath>
 #include <cstdlib>
 #include <memory>
 #endif
@@ -32,8 +33,10 @@
 #include <App/DocumentObjectPy.h>
 #include <Base/Interpreter.h>
 #include <Base/PlacementPy.h>
+#include <Base/VectorPy.h>
 #include <Mod/Part/App/OCCError.h>
 
+#include "FemFrdReader.h"
 #include "FemMesh.h"
 #include "FemMeshObject.h"
 #include "FemMeshPy.h"
@@ -65,6 +68,11 @@ public:
         add_varargs_method("read",
                            &Module::read,
                            "Read a mesh from a file and returns a Mesh object.");
+        add_varargs_method("readFrdResult",
+                           &Module::readFrdResult,
+                           "readFrdResult(string) -- Read the nodes, elements and results of a "
+                           "CalculiX frd file into a dict like "
+                           "importCcxFrdResults.read_frd_result() does.");
 #ifdef FC_USE_VTK
         add_varargs_method("readResult",
                            &Module::readResult,
@@ -229,6 +237,93 @@ private:
         mesh->read(EncodedName.c_str());
         return Py::asObject(new FemMeshPy(mesh.release()));
     }
+    Py::Object readFrdResult(const Py::Tuple& args)
+    {
+        char* Name;
+        if (!PyArg_ParseTuple(args.ptr(), "et", "utf-8", &Name)) {
+            throw Py::Exception();
+        }
+
+        std::string EncodedName = std::string(Name);
+        PyMem_Free(Name);
+
+        FrdReader reader(EncodedName);
+        reader.read();
+
+        Py::Dict dict;
+        Py::Dict nodes;
+        const std::vector<int>& nodeIds = reader.getNodeIds();
+        for (std::size_t i = 0; i < nodeIds.size(); i++) {
+            nodes[Py::Long(nodeIds[i])] = Py::asObject(new Base::VectorPy(reader.getNodes()[i]));
+        }
+        dict["Nodes"] = nodes;
+
+        const char* elementNames[] = {"Seg2Elem",
+                                      "Seg3Elem",
+                                      "Tria3Elem",
+                                      "Tria6Elem",
+                                      "Quad4Elem",
+                                      "Quad8Elem",
+                                      "Tetra4Elem",
+                                      "Tetra10Elem",
+                                      "Hexa8Elem",
+                                      "Hexa20Elem",
+                                      "Penta6Elem",
+                                      "Penta15Elem"};
+        for (const char* name : elementNames) {
+            Py::Dict elements;
+            auto it = reader.getElements().find(name);
+            if (it != reader.getElements().end()) {
+                const FrdReader::Elements& group = it->second;
+                for (std::size_t i = 0; i < group.ids.size(); i++) {
+                    Py::Tuple elementNodes(group.nodesPerElement);
+                    for (int j = 0; j < group.nodesPerElement; j++) {
+                        elementNodes[j] = Py::Long(group.nodes[i * group.nodesPerElement + j]);
+                    }
+                    elements[Py::Long(group.ids[i])] = elementNodes;
+                }
+            }
+            dict[name] = elements;
+        }
+
+        Py::List results;
+        for (const auto& set : reader.getResults()) {
+            Py::Dict result;
+            if (set.number > 0) {
+                result["number"] = Py::Long(set.number);
+            }
+            else {
+                result["number"] = Py::Float(std::nan(""));
+            }
+            result["time"] = Py::Float(set.time);
+            for (const auto& it : set.fields) {
+                const FrdReader::Field& field = it.second;
+                Py::Dict values;
+                for (std::size_t i = 0; i < field.nodes.size(); i++) {
+                    const double* value = &field.values[i * field.components];
+                    Py::Long key(field.nodes[i]);
+                    if (field.components == 1) {
+                        values[key] = Py::Float(value[0]);
+                    }
+                    else if (field.components == 3) {
+                        values[key] = Py::asObject(
+                            new Base::VectorPy(Base::Vector3d(value[0], value[1], value[2])));
+                    }
+                    else {
+                        Py::Tuple tuple(field.components);
+                        for (int j = 0; j < field.components; j++) {
+                            tuple[j] = Py::Float(value[j]);
+                        }
+                        values[key] = tuple;
+                    }
+                }
+                result[it.first] = values;
+            }
+            results.append(result);
+        }
+        dict["Results"] = results;
+        return dict;
+    }
 
 #ifdef FC_USE_VTK
     Py::Object readResult(const Py::Tuple& args)
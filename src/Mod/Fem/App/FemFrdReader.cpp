@@ -0,0 +1,404 @@
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Parallel.h>
+#include <Base/Stream.h>
+
+#include "FemFrdReader.h"
+
+
+using namespace Fem;
+
+namespace
+{
+
+// A line of the file without its line break. The columns are counted from 0 like the
+// slices of the lines in importCcxFrdResults.
+struct Line
+{
+    const char* begin {nullptr};
+    const char* end {nullptr};
+
+    std::size_t size() const
+    {
+        return end - begin;
+    }
+    bool has(std::size_t pos, const char* text) const
+    {
+        std::size_t len = std::strlen(text);
+        return pos + len <= size() && std::memcmp(begin + pos, text, len) == 0;
+    }
+    int toInt(std::size_t first, std::size_t last) const
+    {
+        const char* from = nullptr;
+        const char* to = nullptr;
+        columns(first, last, from, to);
+        int value = 0;
+        std::from_chars(from, to, value);
+        return value;
+    }
+    double toDouble(std::size_t first, std::size_t last) const
+    {
+        const char* from = nullptr;
+        const char* to = nullptr;
+        columns(first, last, from, to);
+        double value = 0.0;
+#if defined(__cpp_lib_to_chars)
+        std::from_chars(from, to, value);
+#else
+        char buf[64];
+        std::size_t len = std::min<std::size_t>(to - from, sizeof(buf) - 1);
+        std::memcpy(buf, from, len);
+        buf[len] = '\0';
+        value = std::strtod(buf, nullptr);
+#endif
+        return value;
+    }
+
+private:
+    // the columns [first, last) cut to the line, without the blanks and the plus sign
+    // that from_chars doesn't accept
+    void columns(std::size_t first, std::size_t last, const char*& from, const char*& to) const
+    {
+        from = begin + std::min(first, size());
+        to = begin + std::min(last, size());
+        while (from < to && (*from == ' ' || *from == '+')) {
+            ++from;
+        }
+    }
+};
+
+struct ElementType
+{
+    const char* name;
+    int lines;
+    // the fields of the frd lines, counted from 1, in the node order of FemMesh
+    std::vector<int> order;
+};
+
+// node order fits with node order in writeABAQUS(), for the quadratic volumes the order of
+// the frd file differs from the one of the inp file, see importCcxFrdResults
+const std::map<int, ElementType>& elementTypes()
+{
+    static const std::map<int, ElementType> types {
+        {1, {"Hexa8Elem", 1, {6, 7, 8, 5, 2, 3, 4, 1}}},
+        {2, {"Penta6Elem", 1, {5, 6, 4, 2, 3, 1}}},
+        {3, {"Tetra4Elem", 1, {2, 1, 3, 4}}},
+        {4,
+         {"Hexa20Elem",
+          2,
+          {8, 5, 6, 7, 4, 1, 2, 3, 20, 17, 18, 19, 12, 9, 10, 11, 16, 13, 14, 15}}},
+        {5, {"Penta15Elem", 2, {5, 6, 4, 2, 3, 1, 14, 15, 13, 8, 9, 7, 11, 12, 10}}},
+        {6, {"Tetra10Elem", 1, {2, 1, 3, 4, 5, 7, 6, 9, 8, 10}}},
+        {7, {"Tria3Elem", 1, {1, 2, 3}}},
+        {8, {"Tria6Elem", 1, {1, 2, 3, 4, 5, 6}}},
+        {9, {"Quad4Elem", 1, {1, 2, 3, 4}}},
+        {10, {"Quad8Elem", 1, {1, 2, 3, 4, 5, 6, 7, 8}}},
+        {11, {"Seg2Elem", 1, {1, 2}}},
+        {12, {"Seg3Elem", 1, {1, 2, 3}}},
+    };
+    return types;
+}
+
+struct FieldType
+{
+    // the name in the "-4" line of the block, starting at column 5
+    const char* key;
+    const char* name;
+    int components;
+    double scale;
+};
+
+const FieldType fieldTypes[] = {
+    {"DISP", "disp", 3, 1.0},
+    {"STRESS", "stress", 6, 1.0},
+    {"TOSTRAIN", "strain", 6, 1.0},
+    {"PE", "peeq", 1, 1.0},
+    {"NDTEMP", "temp", 1, 1.0},
+    {"FLUX", "heatflux", 3, 1.0},
+    // convert units to kg/s from t/s
+    {"MAFLOW", "mflow", 1, 1000.0},
+    {"STPRES", "npressure", 1, 1.0},
+};
+constexpr int numFieldTypes = sizeof(fieldTypes) / sizeof(fieldTypes[0]);
+
+struct ElementLines
+{
+    Line head;
+    Line first;
+    Line second;
+    const ElementType* type;
+};
+
+struct ResultLines
+{
+    int number {0};
+    double time {std::numeric_limits<double>::quiet_NaN()};
+    std::map<int, std::vector<Line>> fields;
+};
+
+// Parse ranges of at least 1024 lines in parallel
+template<class Func>
+void forEachRange(std::size_t count, Func func)
+{
+    Base::parallelForRanges(count, 1024, func);
+}
+
+}  // namespace
+
+FrdReader::FrdReader(const std::string& fileName)
+    : fileName(fileName)
+{}
+
+FrdReader::~FrdReader() = default;
+
+void FrdReader::read()
+{
+    nodeIds.clear();
+    nodes.clear();
+    elements.clear();
+    results.clear();
+
+    Base::FileInfo fi(fileName);
+    Base::ifstream file(fi, std::ios::in | std::ios::binary);
+    if (!file) {
+        throw Base::FileException("Cannot open file", fi);
+    }
+    std::string content;
+    file.seekg(0, std::ios::end);
+    content.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0, std::ios::beg);
+    file.read(&content[0], static_cast<std::streamsize>(content.size()));
+    content.resize(static_cast<std::size_t>(file.gcount()));
+
+    // Follow the block structure like read_frd_result() of importCcxFrdResults does, but
+    // only remember the data lines
+    std::vector<Line> nodeLines;
+    std::vector<ElementLines> elementLines;
+    std::vector<ResultLines> resultLines;
+    std::vector<Line> fieldLines[numFieldTypes];
+    bool fieldFound[numFieldTypes] = {};
+    ResultLines current;
+
+    bool nodesFound = false;
+    bool elementsFound = false;
+    bool timeFound = false;
+    bool endOfSectionFound = false;
+    bool endOfDataFound = false;
+    bool nodeElementSection = false;
+    bool inputContinues = false;
+    bool eigenChanged = false;
+    bool timeChanged = false;
+    int eigenmode = 0;
+    double timestep = 0.0;
+    const ElementType* elemType = nullptr;
+    Line elemHead;
+    Line elemFirst;
+
+    const char* pos = content.data();
+    const char* end = pos + content.size();
+    while (pos < end) {
+        auto next = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+        Line line {pos, next ? next : end};
+        if (line.end > line.begin && line.end[-1] == '\r') {
+            --line.end;
+        }
+        pos = next ? next + 1 : end;
+
+        // nodes and elements
+        if (line.has(4, "2C")) {
+            nodesFound = true;
+        }
+        if (nodesFound && line.has(1, "-1")) {
+            nodeLines.push_back(line);
+        }
+        if (line.has(4, "3C")) {
+            elementsFound = true;
+        }
+        if (elementsFound && line.has(1, "-1")) {
+            auto it = elementTypes().find(line.toInt(14, 18));
+            elemType = it != elementTypes().end() ? &it->second : nullptr;
+            elemHead = line;
+        }
+        if (elementsFound && line.has(1, "-2") && elemType) {
+            if (elemType->lines == 1) {
+                elementLines.push_back({elemHead, line, Line(), elemType});
+            }
+            else if (!inputContinues) {
+                elemFirst = line;
+                inputContinues = true;
+            }
+            else {
+                elementLines.push_back({elemHead, elemFirst, line, elemType});
+                inputContinues = false;
+            }
+        }
+
+        // new eigen mode or time step
+        if (line.has(5, "PMODE")) {
+            int mode = line.toInt(30, 36);
+            if (mode > eigenmode) {
+                eigenmode = mode;
+                eigenChanged = true;
+            }
+        }
+        if (line.has(4, "1PSTEP")) {
+            timeFound = true;
+        }
+        if (timeFound && line.has(2, "100CL")) {
+            double time = line.toDouble(13, 25);
+            if (time > timestep) {
+                timestep = time;
+                timeChanged = true;
+            }
+        }
+
+        // result blocks
+        for (int i = 0; i < numFieldTypes; i++) {
+            if (line.has(5, fieldTypes[i].key)) {
+                fieldFound[i] = true;
+            }
+            if (fieldFound[i] && line.has(1, "-1")) {
+                fieldLines[i].push_back(line);
+            }
+        }
+
+        // end of a block
+        if (line.has(1, "-3")) {
+            endOfSectionFound = true;
+            if (nodesFound) {
+                nodesFound = false;
+                nodeElementSection = true;
+            }
+            if (elementsFound) {
+                elementsFound = false;
+                nodeElementSection = true;
+            }
+            for (int i = 0; i < numFieldTypes; i++) {
+                if (fieldFound[i]) {
+                    current.fields[i] = std::move(fieldLines[i]);
+                    fieldLines[i].clear();
+                    fieldFound[i] = false;
+                    nodeElementSection = false;
+                }
+            }
+        }
+        if (line.has(1, "9999")) {
+            endOfDataFound = true;
+        }
+
+        if ((eigenChanged || timeChanged || endOfDataFound) && endOfSectionFound
+            && !nodeElementSection) {
+            resultLines.push_back(std::move(current));
+            current = ResultLines();
+            endOfSectionFound = false;
+        }
+        if (eigenChanged) {
+            current.number = eigenmode;
+            eigenChanged = false;
+        }
+        if (timeChanged) {
+            current.time = timestep;
+            timeFound = false;
+            timeChanged = false;
+        }
+    }
+
+    // parse the numbers
+    nodeIds.resize(nodeLines.size());
+    nodes.resize(nodeLines.size());
+    forEachRange(nodeLines.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const Line& line = nodeLines[i];
+            nodeIds[i] = line.toInt(4, 13);
+            nodes[i].Set(line.toDouble(13, 25), line.toDouble(25, 37), line.toDouble(37, 49));
+        }
+    });
+
+    std::vector<std::pair<Elements*, std::size_t>> elementSlots;
+    elementSlots.reserve(elementLines.size());
+    for (const auto& it : elementLines) {
+        Elements& group = elements[it.type->name];
+        group.nodesPerElement = static_cast<int>(it.type->order.size());
+        elementSlots.emplace_back(&group, group.ids.size());
+        group.ids.push_back(0);
+    }
+    for (auto& it : elements) {
+        it.second.nodes.resize(it.second.ids.size() * it.second.nodesPerElement);
+    }
+    forEachRange(elementLines.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const ElementLines& lines = elementLines[i];
+            Elements& group = *elementSlots[i].first;
+            std::size_t slot = elementSlots[i].second;
+            group.ids[slot] = lines.head.toInt(4, 13);
+            int* elementNodes = &group.nodes[slot * group.nodesPerElement];
+            for (int field : lines.type->order) {
+                // ten node ids per line
+                const Line& line = field <= 10 ? lines.first : lines.second;
+                std::size_t column = 3 + 10 * ((field - 1) % 10);
+                *elementNodes++ = line.toInt(column, column + 10);
+            }
+        }
+    });
+
+    results.resize(resultLines.size());
+    for (std::size_t set = 0; set < resultLines.size(); set++) {
+        results[set].number = resultLines[set].number;
+        results[set].time = resultLines[set].time;
+        for (const auto& it : resultLines[set].fields) {
+            const FieldType& type = fieldTypes[it.first];
+            const std::vector<Line>& lines = it.second;
+            Field& field = results[set].fields[type.name];
+            field.components = type.components;
+            field.nodes.resize(lines.size());
+            field.values.resize(lines.size() * type.components);
+            forEachRange(lines.size(), [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) {
+                    const Line& line = lines[i];
+                    field.nodes[i] = line.toInt(4, 13);
+                    double* values = &field.values[i * type.components];
+                    for (int j = 0; j < type.components; j++) {
+                        values[j] = type.scale * line.toDouble(13 + 12 * j, 25 + 12 * j);
+                    }
+                    if (type.components == 6) {
+                        // CalculiX frd files: (xx, yy, zz, xy, yz, zx)
+                        // FreeCAD:            (xx, yy, zz, xy, xz, yz)
+                        // thus exchange the last two entries
+                        std::swap(values[4], values[5]);
+                    }
+                }
+            });
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef FEM_FEMFRDREADER_H
+#define FEM_FEMFRDREADER_H
+
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <Base/Vector3D.h>
+#include <Mod/Fem/FemGlobal.h>
+
+
+namespace Fem
+{
+
+/** Reader for the result files (.frd) of CalculiX.
+ * The file is loaded at once. A sequential pass over its lines only follows the block
+ * structure and remembers the data lines of every block, their numbers are then parsed in
+ * parallel. The data is grouped like the dictionary of read_frd_result() in the Python module
+ * importCcxFrdResults, and the node order of the elements is the one of FemMesh.
+ */
+class FemExport FrdReader
+{
+public:
+    /// elements of one type, nodesPerElement node ids per element in one array
+    struct Elements
+    {
+        int nodesPerElement {0};
+        std::vector<int> ids;
+        std::vector<int> nodes;
+    };
+    /// one result block, components values per node in one array
+    struct Field
+    {
+        int components {0};
+        std::vector<int> nodes;
+        std::vector<double> values;
+    };
+    /// the result blocks of one increment or eigen mode
+    struct ResultSet
+    {
+        /// number of the eigen mode, 0 if it isn't one
+        int number {0};
+        /// time of the increment, NaN if there is none
+        double time {std::numeric_limits<double>::quiet_NaN()};
+        /// the blocks by their names in read_frd_result(), e.g. "disp" or "stress"
+        std::map<std::string, Field> fields;
+    };
+
+    explicit FrdReader(const std::string& fileName);
+    ~FrdReader();
+
+    /// reads the file, throws a Base::FileException if it cannot be opened
+    void read();
+
+    const std::vector<int>& getNodeIds() const
+    {
+        return nodeIds;
+    }
+    const std::vector<Base::Vector3d>& getNodes() const
+    {
+        return nodes;
+    }
+    /// the elements by their names in read_frd_result(), e.g. "Tetra10Elem"
+    const std::map<std::string, Elements>& getElements() const
+    {
+        return elements;
+    }
+    const std::vector<ResultSet>& getResults() const
+    {
+        return results;
+    }
+
+private:
+    std::string fileName;
+    std::vector<int> nodeIds;
+    std::vector<Base::Vector3d> nodes;
+    std::map<std::string, Elements> elements;
+    std::vector<ResultSet> results;
+};
+
+}  // namespace Fem
+
+
+#endif  // FEM_FEMFRDREADER_H
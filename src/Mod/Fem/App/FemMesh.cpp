@@ -24,14 +24,25 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
 #include <cstdlib>
+#include <functional>
+#include <limits>
+#include <map>
 #include <memory>
+#include <tuple>
+#include <type_traits>
 
+#include <BRepAdaptor_Curve.hxx>
 #include <BRepBndLib.hxx>
-#include <BRepBuilderAPI_MakeVertex.hxx>
-#include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
+#include <GCPnts_QuasiUniformDeflection.hxx>
+#include <Poly_Triangulation.hxx>
 #include <SMDS_MeshGroup.hxx>
 #include <SMESHDS_Group.hxx>
 #include <SMESHDS_GroupBase.hxx>
@@ -50,6 +61,8 @@
 #include <StdMeshers_Quadrangle_2D.hxx>
 #include <StdMeshers_Regular_1D.hxx>
 #include <StdMeshers_StartEndLength.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Solid.hxx>
@@ -64,13 +77,17 @@
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/Parallel.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/TimeInfo.h>
 #include <Base/Writer.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Part/App/Tools.h>
+#include <Mod/Part/App/TopoShape.h>
 
 #include "FemMesh.h"
+#include "FemMeshNodeTree.h"
 #include <FemMeshPy.h>
 
 #ifdef FC_USE_VTK
@@ -260,6 +277,16 @@ void FemMesh::copyMeshData(const FemMesh& mesh)
     }
 
     newMeshDS->Modified();
+
+    // The time stamps of the new SMESH mesh start again, so the node tree can't be kept. The
+    // copy keeps the node IDs though, so a tree that is current for the source can be shared.
+    std::scoped_lock lock(nodeTreeMutex, mesh.nodeTreeMutex);
+    nodeTree.reset();
+    if (mesh.nodeTree && mesh.nodeTreeTime == mesh.getModificationTime()) {
+        nodeTree = mesh.nodeTree;
+        nodeTreeTime = getModificationTime();
+        nodeTreeMatrix = mesh.nodeTreeMatrix;
+    }
 }
 
 const SMESH_Mesh* FemMesh::getSMesh() const
@@ -337,66 +364,125 @@ std::set<long> FemMesh::getSurfaceNodes(long /*ElemId*/, short /*FaceId*/, float
     return result;
 }
 
-/*! That function returns map containing volume ID and face ID.
- */
-std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face) const
+namespace
 {
-    std::list<std::pair<int, int>> result;
-    std::set<int> nodes_on_face = getNodesByFace(face);
-
-    // SMDS_MeshVolume::facesIterator() is broken with SMESH7 as it is impossible
-    // to iterate volume faces
-    // In SMESH9 this function has been removed
-    //
-    std::map<int, std::set<int>> face_nodes;
+// true if all nodes of the element are in the sorted list of node IDs
+bool allNodesIn(const SMDS_MeshElement* elem, const std::vector<int>& nodeIds)
+{
+    for (int i = 0; i < elem->NbNodes(); i++) {
+        if (!std::binary_search(nodeIds.begin(), nodeIds.end(), elem->GetNode(i)->GetID())) {
+            return false;
+        }
+    }
+    return true;
+}
 
-    // get faces that contribute to 'nodes_on_face' with all of its nodes
-    SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
-    while (face_iter && face_iter->more()) {
-        const SMDS_MeshFace* face = face_iter->next();
-        SMDS_NodeIteratorPtr node_iter = face->nodeIterator();
+// IDs of the elements of the given type that use at least one of the nodes, sorted
+std::vector<int> elementsOfNodes(SMESHDS_Mesh* meshDS,
+                                 const std::vector<int>& nodeIds,
+                                 SMDSAbs_ElementType type)
+{
+    std::vector<int> result;
+    for (int id : nodeIds) {
+        const SMDS_MeshNode* node = meshDS->FindNode(id);
+        if (!node) {
+            continue;
+        }
+        SMDS_ElemIteratorPtr it = node->GetInverseElementIterator(type);
+        while (it->more()) {
+            result.push_back(it->next()->GetID());
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
 
-        // all nodes of the current face must be part of 'nodes_on_face'
-        std::set<int> node_ids;
-        while (node_iter && node_iter->more()) {
-            const SMDS_MeshNode* node = node_iter->next();
-            node_ids.insert(node->GetID());
+// elements of the given type whose nodes all are in the sorted list of node IDs
+std::list<int> elementsOnNodes(SMESHDS_Mesh* meshDS,
+                               const std::vector<int>& nodeIds,
+                               SMDSAbs_ElementType type)
+{
+    std::list<int> result;
+    for (int id : elementsOfNodes(meshDS, nodeIds, type)) {
+        if (allNodesIn(meshDS->FindElement(id), nodeIds)) {
+            result.push_back(id);
         }
+    }
+    return result;
+}
 
-        std::vector<int> element_face_nodes;
-        std::set_intersection(nodes_on_face.begin(),
-                              nodes_on_face.end(),
-                              node_ids.begin(),
-                              node_ids.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_face_nodes));
+Base::BoundBox3d toBoundBox(const Bnd_Box& box)
+{
+    if (box.IsVoid()) {
+        return Base::BoundBox3d();
+    }
+    double xMin, yMin, zMin, xMax, yMax, zMax;
+    box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    return Base::BoundBox3d(xMin, yMin, zMin, xMax, yMax, zMax);
+}
+
+// the linear deflection used to tessellate a shape for filtering the nodes
+double filterDeflection(const Bnd_Box& box, double limit)
+{
+    return std::max(0.001 * std::sqrt(box.SquareExtent()), limit);
+}
 
-        if (element_face_nodes.size() == node_ids.size()) {
-            face_nodes[face->GetID()] = node_ids;
+// measures the exact distance of the marked nodes to the shape and returns the IDs of those
+// that are closer than limit
+std::vector<int> measureNodes(const TopoDS_Shape& shape,
+                              const FemMeshNodeTree& tree,
+                              const std::vector<char>& candidates,
+                              double limit)
+{
+    std::vector<int> ids;
+    std::vector<Base::Vector3d> points;
+    for (std::size_t i = 0; i < candidates.size(); i++) {
+        if (candidates[i]) {
+            ids.push_back(tree.id(i));
+            points.push_back(tree.point(i));
         }
     }
 
-    // get all nodes of a volume and check which faces contribute to it with all of its nodes
-    SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    while (vol_iter->more()) {
-        const SMDS_MeshVolume* vol = vol_iter->next();
-        SMDS_NodeIteratorPtr node_iter = vol->nodeIterator();
-        std::set<int> node_ids;
-        while (node_iter && node_iter->more()) {
-            const SMDS_MeshNode* node = node_iter->next();
-            node_ids.insert(node->GetID());
+    std::vector<int> result;
+    std::vector<double> distances = Part::TopoShape(shape).distanceToPoints(points);
+    for (std::size_t i = 0; i < distances.size(); ++i) {
+        if (distances[i] >= 0.0 && distances[i] < limit) {
+            result.push_back(ids[i]);
         }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+}  // namespace
 
-        for (const auto& it : face_nodes) {
-            std::vector<int> element_face_nodes;
-            std::set_intersection(node_ids.begin(),
-                                  node_ids.end(),
-                                  it.second.begin(),
-                                  it.second.end(),
-                                  std::back_insert_iterator<std::vector<int>>(element_face_nodes));
+/*! That function returns map containing volume ID and face ID.
+ */
+std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face) const
+{
+    std::list<std::pair<int, int>> result;
+    std::vector<int> nodes_on_face = getNodesByFace(face);
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
 
-            // For curved faces it is possible that a volume contributes more than one face
-            if (element_face_nodes.size() == it.second.size()) {
-                result.emplace_back(vol->GetID(), it.first);
+    // SMDS_MeshVolume::facesIterator() is broken with SMESH7 as it is impossible
+    // to iterate volume faces
+    // In SMESH9 this function has been removed
+    //
+    // get faces that contribute to 'nodes_on_face' with all of its nodes, then the volumes
+    // that contain all nodes of such a face. For curved faces it is possible that a volume
+    // contributes more than one face
+    for (int faceId : elementsOnNodes(meshDS, nodes_on_face, SMDSAbs_Face)) {
+        const SMDS_MeshElement* meshFace = meshDS->FindElement(faceId);
+        SMDS_ElemIteratorPtr vol_iter =
+            meshFace->GetNode(0)->GetInverseElementIterator(SMDSAbs_Volume);
+        while (vol_iter->more()) {
+            const SMDS_MeshElement* vol = vol_iter->next();
+            bool contains = true;
+            for (int i = 0; i < meshFace->NbNodes() && contains; i++) {
+                contains = vol->GetNodeIndex(meshFace->GetNode(i)) >= 0;
+            }
+            if (contains) {
+                result.emplace_back(vol->GetID(), faceId);
             }
         }
     }
@@ -409,65 +495,14 @@ std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face
 std::list<int> FemMesh::getFacesByFace(const TopoDS_Face& face) const
 {
     // TODO: This function is broken with SMESH7 as it is impossible to iterate volume faces
-    std::list<int> result;
-    std::set<int> nodes_on_face = getNodesByFace(face);
-
-    SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
-    while (face_iter->more()) {
-        const SMDS_MeshFace* face = static_cast<const SMDS_MeshFace*>(face_iter->next());
-        int numNodes = face->NbNodes();
-
-        std::set<int> face_nodes;
-        for (int i = 0; i < numNodes; i++) {
-            face_nodes.insert(face->GetNode(i)->GetID());
-        }
-
-        std::vector<int> element_face_nodes;
-        std::set_intersection(nodes_on_face.begin(),
-                              nodes_on_face.end(),
-                              face_nodes.begin(),
-                              face_nodes.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_face_nodes));
-
-        // For curved faces it is possible that a volume contributes more than one face
-        if (element_face_nodes.size() == static_cast<std::size_t>(numNodes)) {
-            result.push_back(face->GetID());
-        }
-    }
-
-    result.sort();
-    return result;
+    std::vector<int> nodes_on_face = getNodesByFace(face);
+    return elementsOnNodes(myMesh->GetMeshDS(), nodes_on_face, SMDSAbs_Face);
 }
 
 std::list<int> FemMesh::getEdgesByEdge(const TopoDS_Edge& edge) const
 {
-    std::list<int> result;
-    std::set<int> nodes_on_edge = getNodesByEdge(edge);
-
-    SMDS_EdgeIteratorPtr edge_iter = myMesh->GetMeshDS()->edgesIterator();
-    while (edge_iter->more()) {
-        const SMDS_MeshEdge* edge = static_cast<const SMDS_MeshEdge*>(edge_iter->next());
-        int numNodes = edge->NbNodes();
-
-        std::set<int> edge_nodes;
-        for (int i = 0; i < numNodes; i++) {
-            edge_nodes.insert(edge->GetNode(i)->GetID());
-        }
-
-        std::vector<int> element_edge_nodes;
-        std::set_intersection(nodes_on_edge.begin(),
-                              nodes_on_edge.end(),
-                              edge_nodes.begin(),
-                              edge_nodes.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_edge_nodes));
-
-        if (element_edge_nodes.size() == static_cast<std::size_t>(numNodes)) {
-            result.push_back(edge->GetID());
-        }
-    }
-
-    result.sort();
-    return result;
+    std::vector<int> nodes_on_edge = getNodesByEdge(edge);
+    return elementsOnNodes(myMesh->GetMeshDS(), nodes_on_edge, SMDSAbs_Edge);
 }
 
 /*! That function returns map containing volume ID and face number
@@ -477,7 +512,8 @@ std::list<int> FemMesh::getEdgesByEdge(const TopoDS_Edge& edge) const
 std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
 {
     std::map<int, int> result;
-    std::set<int> nodes_on_face = getNodesByFace(face);
+    std::vector<int> nodes_on_face = getNodesByFace(face);
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
 
     static std::map<int, std::vector<int>> elem_order;
     if (elem_order.empty()) {
@@ -488,11 +524,10 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
         elem_order.insert(std::make_pair(c3d10.size(), c3d10));
     }
 
-    SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    std::set<int> element_nodes;
+    // only volumes using a node of the face can have a face on it
     int num_of_nodes;
-    while (vol_iter->more()) {
-        const SMDS_MeshVolume* vol = vol_iter->next();
+    for (int volId : elementsOfNodes(meshDS, nodes_on_face, SMDSAbs_Volume)) {
+        const SMDS_MeshElement* vol = meshDS->FindElement(volId);
         num_of_nodes = vol->NbNodes();
         std::pair<int, std::vector<int>> apair;
         apair.first = vol->GetID();
@@ -557,10 +592,45 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
     return result;
 }
 
-std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
+std::uint64_t FemMesh::getModificationTime() const
+{
+    // SMDS_Mesh only flags changes to its nodes and elements, Modified() turns them into a new
+    // time stamp
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    meshDS->Modified();
+    return meshDS->GetMTime();
+}
+
+std::shared_ptr<const FemMeshNodeTree> FemMesh::getNodeTree() const
 {
-    std::set<int> result;
+    std::lock_guard<std::mutex> lock(nodeTreeMutex);
+    std::uint64_t time = getModificationTime();
+    Base::Matrix4D Mtrx(getTransform());
+    if (nodeTree && nodeTreeTime == time && nodeTreeMatrix == Mtrx) {
+        return nodeTree;
+    }
+
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    std::vector<int> ids;
+    std::vector<Base::Vector3d> points;
+    ids.reserve(meshDS->NbNodes());
+    points.reserve(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
+    while (aNodeIter->more()) {
+        const SMDS_MeshNode* aNode = aNodeIter->next();
+        ids.push_back(aNode->GetID());
+        // Apply the matrix to hold the nodes in absolute space.
+        points.push_back(Mtrx * Base::Vector3d(aNode->X(), aNode->Y(), aNode->Z()));
+    }
+
+    nodeTree = std::make_shared<const FemMeshNodeTree>(std::move(ids), std::move(points));
+    nodeTreeTime = time;
+    nodeTreeMatrix = Mtrx;
+    return nodeTree;
+}
 
+std::vector<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
+{
     Bnd_Box box;
     BRepBndLib::Add(solid, box);
 
@@ -572,50 +642,18 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
                         limit,
                         limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-    return result;
+    // measure the nodes inside the bounding box all at once
+    std::shared_ptr<const FemMeshNodeTree> sharedTree = getNodeTree();
+    const FemMeshNodeTree& tree = *sharedTree;
+    std::vector<char> candidates(tree.size(), 0);
+    tree.visitBox(toBoundBox(box), [&](std::size_t index) {
+        candidates[index] = 1;
+    });
+    return measureNodes(solid, tree, candidates, limit);
 }
 
-std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
+std::vector<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(
         face,
@@ -625,133 +663,101 @@ std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
     double limit = BRep_Tool::Tolerance(face);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
+    std::shared_ptr<const FemMeshNodeTree> sharedTree = getNodeTree();
+    const FemMeshNodeTree& tree = *sharedTree;
+    std::vector<char> candidates(tree.size(), 0);
+
+    // Only the nodes close to a triangle of the tessellated face are measured exactly. The face
+    // deviates from its triangles by at most the deflection, twice of it is used as margin.
+    // the face is usually shared with a document object, so a copy of it is tessellated
+    double deflection = filterDeflection(box, limit);
+    TopoDS_Face meshedFace = TopoDS::Face(BRepBuilderAPI_Copy(face).Shape());
+    BRepMesh_IncrementalMesh mesher(meshedFace, deflection);
+    TopLoc_Location loc;
+    Handle(Poly_Triangulation) hTria = BRep_Tool::Triangulation(meshedFace, loc);
+    std::vector<gp_Pnt> points;
+    std::vector<Poly_Triangle> facets;
+    if (!hTria.IsNull() && Part::Tools::getTriangulation(meshedFace, points, facets)) {
+        double eps = limit + 2.0 * std::max(deflection, hTria->Deflection());
+        for (const auto& facet : facets) {
+            Standard_Integer n1, n2, n3;
+            facet.Get(n1, n2, n3);
+            Base::Vector3d p1 = Base::convertTo<Base::Vector3d>(points[n1]);
+            Base::Vector3d p2 = Base::convertTo<Base::Vector3d>(points[n2]);
+            Base::Vector3d p3 = Base::convertTo<Base::Vector3d>(points[n3]);
+            Base::BoundBox3d triaBox;
+            triaBox.Add(p1);
+            triaBox.Add(p2);
+            triaBox.Add(p3);
+            triaBox.Enlarge(eps);
+            Base::Vector3d normal = (p2 - p1) % (p3 - p1);
+            double length = normal.Length();
+            tree.visitBox(triaBox, [&](std::size_t index) {
+                // reject the nodes too far from the plane of the triangle
+                if (length <= 0.0 || std::fabs(normal * (tree.point(index) - p1)) <= eps * length) {
+                    candidates[index] = 1;
+                }
+            });
         }
     }
+    else {
+        tree.visitBox(toBoundBox(box), [&](std::size_t index) {
+            candidates[index] = 1;
+        });
+    }
 
-    return result;
+    return measureNodes(face, tree, candidates, limit);
 }
 
-std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
+std::vector<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(edge, box);
     // limit where the mesh node belongs to the edge:
     double limit = BRep_Tool::Tolerance(edge);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
+    std::shared_ptr<const FemMeshNodeTree> sharedTree = getNodeTree();
+    const FemMeshNodeTree& tree = *sharedTree;
+    std::vector<char> candidates(tree.size(), 0);
+
+    // Only the nodes close to a segment of the discretized edge are measured exactly
+    double deflection = filterDeflection(box, limit);
+    BRepAdaptor_Curve curve(edge);
+    GCPnts_QuasiUniformDeflection discretizer(curve, deflection);
+    if (discretizer.IsDone() && discretizer.NbPoints() > 1) {
+        double eps = limit + 2.0 * deflection;
+        for (int i = 1; i < discretizer.NbPoints(); i++) {
+            Base::Vector3d p1 = Base::convertTo<Base::Vector3d>(discretizer.Value(i));
+            Base::Vector3d p2 = Base::convertTo<Base::Vector3d>(discretizer.Value(i + 1));
+            Base::BoundBox3d segmentBox;
+            segmentBox.Add(p1);
+            segmentBox.Add(p2);
+            segmentBox.Enlarge(eps);
+            tree.visitBox(segmentBox, [&](std::size_t index) {
+                const Base::Vector3d& pnt = tree.point(index);
+                if (pnt.DistanceToLineSegment(p1, p2).Length() <= eps) {
+                    candidates[index] = 1;
+                }
+            });
         }
     }
+    else {
+        tree.visitBox(toBoundBox(box), [&](std::size_t index) {
+            candidates[index] = 1;
+        });
+    }
 
-    return result;
+    return measureNodes(edge, tree, candidates, limit);
 }
 
-std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
+std::vector<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
 {
-    std::set<int> result;
-
     double limit = BRep_Tool::Tolerance(vertex);
-    limit *= limit;  // use square to improve speed
     gp_Pnt pnt = BRep_Tool::Pnt(vertex);
     Base::Vector3d node(pnt.X(), pnt.Y(), pnt.Z());
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        vec = Mtrx * vec;
-
-        if (Base::DistanceP2(node, vec) <= limit)
-#pragma omp critical
-        {
-            result.insert(aNode->GetID());
-        }
-    }
-
-    return result;
+    return getNodeTree()->findInSphere(node, limit);
 }
 
 std::list<int> FemMesh::getElementNodes(int id) const
@@ -1647,6 +1653,48 @@ void FemMesh::read(const char* FileName)
     }
 }
 
+namespace
+{
+
+// Format the lines of a block of an input file in parallel. Every range of items is formatted
+// into its own string, then the strings are written in order.
+template<class Func>
+void writeBlock(std::ostream& out, std::size_t count, Func formatItem)
+{
+    const std::size_t ranges = Base::parallelRangeCount(count, 4096);
+    std::vector<std::string> chunks(ranges);
+    Base::parallelFor(ranges, [&](std::size_t index) {
+        std::string& chunk = chunks[index];
+        for (std::size_t i = count * index / ranges; i < count * (index + 1) / ranges; i++) {
+            formatItem(chunk, i);
+        }
+    });
+    for (const std::string& chunk : chunks) {
+        out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    }
+}
+
+void appendNumber(std::string& str, int value)
+{
+    char buf[16];
+    str.append(buf, std::to_chars(buf, buf + sizeof(buf), value).ptr);
+}
+
+// the same as a stream with precision 13, ccx reads only F20.0 fields
+// https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
+void appendNumber(std::string& str, double value)
+{
+    char buf[32];
+#if defined(__cpp_lib_to_chars)
+    auto result = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::general, 13);
+    str.append(buf, result.ptr);
+#else
+    str.append(buf, std::snprintf(buf, sizeof(buf), "%.13g", value));
+#endif
+}
+
+}  // namespace
+
 void FemMesh::writeABAQUS(const std::string& Filename,
                           int elemParam,
                           bool groupParam,
@@ -2053,12 +2101,37 @@ void FemMesh::writeABAQUS(const std::string& Filename,
 
     // This way we get sorted output.
     // See https://forum.freecad.org/viewtopic.php?f=18&t=12646&start=40#p103004
-    for (const auto& it : vertexMap) {
-        anABAQUS_Output << it.first << ", " << it.second.x << ", " << it.second.y << ", "
-                        << it.second.z << std::endl;
-    }
+    std::vector<std::pair<int, Base::Vector3d>> vertices(vertexMap.begin(), vertexMap.end());
+    writeBlock(anABAQUS_Output, vertices.size(), [&vertices](std::string& str, std::size_t i) {
+        const Base::Vector3d& vertex = vertices[i].second;
+        appendNumber(str, vertices[i].first);
+        str += ", ";
+        appendNumber(str, vertex.x);
+        str += ", ";
+        appendNumber(str, vertex.y);
+        str += ", ";
+        appendNumber(str, vertex.z);
+        str += '\n';
+    });
     anABAQUS_Output << std::endl << std::endl;
-    ;
+
+    // one element per line, wrapped lines hold the nodes from the 16th on
+    auto writeElements = [&anABAQUS_Output](const NodesMap& nodesMap, bool wrap) {
+        std::vector<const NodesMap::value_type*> items;
+        items.reserve(nodesMap.size());
+        for (const auto& it : nodesMap) {
+            items.push_back(&it);
+        }
+        writeBlock(anABAQUS_Output, items.size(), [&items, wrap](std::string& str, std::size_t i) {
+            appendNumber(str, items[i]->first);
+            const std::vector<int>& nodes = items[i]->second;
+            for (std::size_t j = 0; j < nodes.size(); j++) {
+                str += wrap && j == 15 ? ",\n" : ", ";
+                appendNumber(str, nodes[j]);
+            }
+            str += '\n';
+        });
+    };
 
 
     // write volumes to file
@@ -2067,27 +2140,8 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         for (const auto& it : elementsMapVol) {
             anABAQUS_Output << "** Volume elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                // Calculix allows max 16 entries in one line, a hexa20 has more !
-                int ct = 0;  // counter
-                bool first_line = true;
-                for (auto kt = jt.second.begin(); kt != jt.second.end(); ++kt, ++ct) {
-                    if (ct < 15) {
-                        anABAQUS_Output << ", " << *kt;
-                    }
-                    else {
-                        if (first_line) {
-                            anABAQUS_Output << "," << std::endl << *kt;
-                            first_line = false;
-                        }
-                        else {
-                            anABAQUS_Output << ", " << *kt;
-                        }
-                    }
-                }
-                anABAQUS_Output << std::endl;
-            }
+            // Calculix allows max 16 entries in one line, a hexa20 has more !
+            writeElements(it.second, true);
         }
         elsetname += "Evolumes";
         anABAQUS_Output << std::endl;
@@ -2098,13 +2152,7 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         for (const auto& it : elementsMapFac) {
             anABAQUS_Output << "** Face elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            writeElements(it.second, false);
         }
         if (elsetname.empty()) {
             elsetname += "Efaces";
@@ -2120,13 +2168,7 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         for (const auto& it : elementsMapEdg) {
             anABAQUS_Output << "** Edge elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            writeElements(it.second, false);
         }
         if (elsetname.empty()) {
             elsetname += "Eedges";
@@ -2196,15 +2238,17 @@ void FemMesh::writeABAQUS(const std::string& Filename,
             }
 
             // get and write group elements
-            std::set<int> ids;
+            std::set<int> idSet;
             SMDS_ElemIteratorPtr aElemIter = myMesh->GetGroup(it)->GetGroupDS()->GetElements();
             while (aElemIter->more()) {
                 const SMDS_MeshElement* aElement = aElemIter->next();
-                ids.insert(aElement->GetID());
-            }
-            for (int it : ids) {
-                anABAQUS_Output << it << std::endl;
+                idSet.insert(aElement->GetID());
             }
+            std::vector<int> ids(idSet.begin(), idSet.end());
+            writeBlock(anABAQUS_Output, ids.size(), [&ids](std::string& str, std::size_t i) {
+                appendNumber(str, ids[i]);
+                str += '\n';
+            });
 
             // write newline after each group
             anABAQUS_Output << std::endl;
@@ -2309,7 +2353,8 @@ void FemMesh::Save(Base::Writer& writer) const
     if (!writer.isForceXML()) {
         // See SaveDocFile(), RestoreDocFile()
         writer.Stream() << writer.ind() << "<FemMesh file=\"";
-        writer.Stream() << writer.addFile("FemMesh.unv", this) << "\"";
+        writer.Stream() << writer.addFile(saveBinary() ? "FemMesh.bin" : "FemMesh.unv", this)
+                        << "\"";
         writer.Stream() << " a11=\"" << _Mtrx[0][0] << "\" a12=\"" << _Mtrx[0][1] << "\" a13=\""
                         << _Mtrx[0][2] << "\" a14=\"" << _Mtrx[0][3] << "\"";
         writer.Stream() << " a21=\"" << _Mtrx[1][0] << "\" a22=\"" << _Mtrx[1][1] << "\" a23=\""
@@ -2366,8 +2411,21 @@ void FemMesh::Restore(Base::XMLReader& reader)
     }
 }
 
+bool FemMesh::saveBinary() const
+{
+    // older versions read any mesh file as UNV, so the binary file has to be enabled
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Fem/General");
+    return hGrp->GetBool("BinaryMeshFile", false);
+}
+
 void FemMesh::SaveDocFile(Base::Writer& writer) const
 {
+    if (saveBinary()) {
+        writeBinary(writer.Stream());
+        return;
+    }
+
     // create a temporary file and copy the content to the zip stream
     Base::FileInfo fi(App::Application::getTempFileName().c_str());
 
@@ -2386,6 +2444,11 @@ void FemMesh::SaveDocFile(Base::Writer& writer) const
 
 void FemMesh::RestoreDocFile(Base::Reader& reader)
 {
+    if (Base::FileInfo(reader.getFileName()).hasExtension("bin")) {
+        readBinary(reader);
+        return;
+    }
+
     // create a temporary file and copy the content from the zip stream
     Base::FileInfo fi(App::Application::getTempFileName().c_str());
 
@@ -2403,6 +2466,304 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
     fi.deleteFile();
 }
 
+namespace
+{
+const uint32_t binaryMeshMagic = 0x464d4553;  // "FMES"
+const uint32_t binaryMeshVersion = 1;
+
+// elements with the same type, the same number of nodes and the same polygon/polyhedron flag
+// are saved together
+struct ElementBlock
+{
+    uint32_t type;
+    uint32_t isPoly;
+    uint32_t nbNodes;  // 0 for polygons and polyhedra
+
+    bool operator<(const ElementBlock& other) const
+    {
+        return std::tie(type, isPoly, nbNodes)
+            < std::tie(other.type, other.isPoly, other.nbNodes);
+    }
+    bool matches(const SMDS_MeshElement* elem) const
+    {
+        return elem->IsPoly() == static_cast<bool>(isPoly)
+            && (isPoly || elem->NbNodes() == static_cast<int>(nbNodes));
+    }
+};
+
+std::vector<int> getPolyhedronQuantities(const SMDS_MeshElement* elem)
+{
+#if SMESH_VERSION_MAJOR >= 9
+    return static_cast<const SMDS_MeshVolume*>(elem)->GetQuantities();
+#else
+    return static_cast<const SMDS_VtkVolume*>(elem)->GetQuantities();
+#endif
+}
+}  // namespace
+
+/* Binary mesh file, used instead of UNV by SaveDocFile(). All arrays are stored
+   contiguously, little endian:
+     uint32 magic, uint32 version
+     uint32 number of nodes, int32 node ids[], double coordinates[] (x, y, z per node)
+     uint32 number of element blocks, for each block:
+       uint32 type (SMDSAbs_ElementType), uint32 polygon/polyhedron flag,
+       uint32 nodes per element (0 for polygons and polyhedra)
+       uint32 number of elements, int32 element ids[]
+       polygons and polyhedra: uint32 nodes per element[]
+       polyhedra: uint32 faces per element[], uint32 nodes per face[]
+       balls: double diameters[]
+       int32 node ids of the elements[]
+     uint32 number of groups, for each group:
+       uint32 name length, name, uint32 type (SMDSAbs_ElementType),
+       uint32 number of members, int32 member ids[]
+*/
+void FemMesh::writeBinary(std::ostream& out) const
+{
+    Base::OutputStream str(out);
+    const SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+
+    str << binaryMeshMagic << binaryMeshVersion;
+
+    str << static_cast<uint32_t>(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr nodeIt = meshDS->nodesIterator();
+    while (nodeIt->more()) {
+        str << static_cast<int32_t>(nodeIt->next()->GetID());
+    }
+    nodeIt = meshDS->nodesIterator();
+    while (nodeIt->more()) {
+        const SMDS_MeshNode* node = nodeIt->next();
+        str << node->X() << node->Y() << node->Z();
+    }
+
+    std::map<ElementBlock, uint32_t> blocks;
+    SMDS_ElemIteratorPtr elemIt = meshDS->elementsIterator();
+    while (elemIt->more()) {
+        const SMDS_MeshElement* elem = elemIt->next();
+        if (elem->GetType() == SMDSAbs_Node) {
+            continue;
+        }
+        ElementBlock block {static_cast<uint32_t>(elem->GetType()),
+                            elem->IsPoly() ? 1U : 0U,
+                            elem->IsPoly() ? 0U : static_cast<uint32_t>(elem->NbNodes())};
+        blocks[block]++;
+    }
+
+    str << static_cast<uint32_t>(blocks.size());
+    for (const auto& it : blocks) {
+        const ElementBlock& block = it.first;
+        auto type = static_cast<SMDSAbs_ElementType>(block.type);
+        bool isPolyhedron = block.isPoly && type == SMDSAbs_Volume;
+
+        // every array is a separate pass over the elements of the block, so that nothing but
+        // the mesh itself is held in memory
+        auto forEachElement = [&](const std::function<void(const SMDS_MeshElement*)>& func) {
+            SMDS_ElemIteratorPtr it = meshDS->elementsIterator(type);
+            while (it->more()) {
+                const SMDS_MeshElement* elem = it->next();
+                if (block.matches(elem)) {
+                    func(elem);
+                }
+            }
+        };
+
+        str << block.type << block.isPoly << block.nbNodes << it.second;
+        forEachElement([&](const SMDS_MeshElement* elem) {
+            str << static_cast<int32_t>(elem->GetID());
+        });
+        if (block.isPoly) {
+            forEachElement([&](const SMDS_MeshElement* elem) {
+                str << static_cast<uint32_t>(elem->NbNodes());
+            });
+        }
+        if (isPolyhedron) {
+            forEachElement([&](const SMDS_MeshElement* elem) {
+                str << static_cast<uint32_t>(getPolyhedronQuantities(elem).size());
+            });
+            forEachElement([&](const SMDS_MeshElement* elem) {
+                for (int quantity : getPolyhedronQuantities(elem)) {
+                    str << static_cast<uint32_t>(quantity);
+                }
+            });
+        }
+        if (type == SMDSAbs_Ball) {
+            forEachElement([&](const SMDS_MeshElement* elem) {
+                str << static_cast<const SMDS_BallElement*>(elem)->GetDiameter();
+            });
+        }
+        forEachElement([&](const SMDS_MeshElement* elem) {
+            SMDS_ElemIteratorPtr nIt = elem->nodesIterator();
+            while (nIt->more()) {
+                str << static_cast<int32_t>(nIt->next()->GetID());
+            }
+        });
+    }
+
+    std::vector<SMESH_Group*> groups;
+    SMESH_Mesh::GroupIteratorPtr gIt = myMesh->GetGroups();
+    while (gIt->more()) {
+        groups.push_back(gIt->next());
+    }
+    str << static_cast<uint32_t>(groups.size());
+    for (auto group : groups) {
+        const SMESHDS_GroupBase* groupDS = group->GetGroupDS();
+        std::string name = group->GetName();
+        str << static_cast<uint32_t>(name.size());
+        str.write(name.c_str(), static_cast<int>(name.size()));
+        str << static_cast<uint32_t>(groupDS->GetType())
+            << static_cast<uint32_t>(groupDS->Extent());
+        SMDS_ElemIteratorPtr eIt = groupDS->GetElements();
+        while (eIt->more()) {
+            str << static_cast<int32_t>(eIt->next()->GetID());
+        }
+    }
+}
+
+void FemMesh::readBinary(std::istream& in)
+{
+    Base::InputStream str(in);
+    uint32_t magic = 0, version = 0;
+    str >> magic >> version;
+    if (magic != binaryMeshMagic || version > binaryMeshVersion) {
+        throw Base::BadFormatError("Unknown FEM mesh file format");
+    }
+
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    meshDS->ClearMesh();
+    SMESH_MeshEditor editor(myMesh);
+
+    // The counts are not trusted until the data has actually been read, so the arrays only grow
+    // with the values read from the stream.
+    const uint32_t maxReserve = 1 << 16;
+    auto readArray = [&str, maxReserve](auto& values, uint32_t count) {
+        values.clear();
+        values.reserve(std::min(count, maxReserve));
+        for (uint32_t i = 0; i < count; i++) {
+            typename std::decay_t<decltype(values)>::value_type value {};
+            str >> value;
+            if (!str) {
+                throw Base::BadFormatError("FEM mesh file is truncated");
+            }
+            values.push_back(value);
+        }
+    };
+
+    uint32_t nbNodes = 0;
+    str >> nbNodes;
+    std::vector<int32_t> ids;
+    readArray(ids, nbNodes);
+    for (int32_t id : ids) {
+        double x, y, z;
+        str >> x >> y >> z;
+        meshDS->AddNodeWithID(x, y, z, id);
+    }
+
+    auto readNodes = [&](std::vector<const SMDS_MeshNode*>& nodes, uint32_t count) {
+        nodes.clear();
+        nodes.reserve(std::min(count, maxReserve));
+        for (uint32_t i = 0; i < count; i++) {
+            int32_t id = 0;
+            str >> id;
+            const SMDS_MeshNode* node = meshDS->FindNode(id);
+            if (!str || !node) {
+                throw Base::BadFormatError("FEM mesh file refers to a missing node");
+            }
+            nodes.push_back(node);
+        }
+    };
+
+    uint32_t nbBlocks = 0;
+    str >> nbBlocks;
+    for (uint32_t iBlock = 0; iBlock < nbBlocks && str; iBlock++) {
+        ElementBlock block {};
+        uint32_t nbElements = 0;
+        str >> block.type >> block.isPoly >> block.nbNodes >> nbElements;
+        auto type = static_cast<SMDSAbs_ElementType>(block.type);
+        bool isPolyhedron = block.isPoly && type == SMDSAbs_Volume;
+
+        readArray(ids, nbElements);
+        std::vector<uint32_t> nodeCounts(nbElements, block.nbNodes);
+        if (block.isPoly) {
+            readArray(nodeCounts, nbElements);
+        }
+        std::vector<uint32_t> faceCounts;
+        std::vector<uint32_t> quantities;
+        if (isPolyhedron) {
+            readArray(faceCounts, nbElements);
+            uint64_t nbQuantities = 0;
+            for (uint32_t count : faceCounts) {
+                nbQuantities += count;
+            }
+            if (nbQuantities > std::numeric_limits<uint32_t>::max()) {
+                throw Base::BadFormatError("Invalid FEM mesh file");
+            }
+            readArray(quantities, static_cast<uint32_t>(nbQuantities));
+        }
+        std::vector<double> diameters;
+        if (type == SMDSAbs_Ball) {
+            readArray(diameters, nbElements);
+        }
+
+        std::vector<const SMDS_MeshNode*> nodes;
+        std::size_t nextQuantity = 0;
+        for (uint32_t iElem = 0; iElem < nbElements; iElem++) {
+            readNodes(nodes, nodeCounts[iElem]);
+            if (isPolyhedron) {
+                std::vector<int> elemQuantities(quantities.begin() + nextQuantity,
+                                                quantities.begin() + nextQuantity
+                                                    + faceCounts[iElem]);
+                nextQuantity += faceCounts[iElem];
+                meshDS->AddPolyhedralVolumeWithID(nodes, elemQuantities, ids[iElem]);
+            }
+            else if (type == SMDSAbs_Ball) {
+                SMESH_MeshEditor::ElemFeatures elemFeat;
+                elemFeat.Init(diameters[iElem]);
+                elemFeat.SetID(ids[iElem]);
+                editor.AddElement(nodes, elemFeat);
+            }
+            else {
+                SMESH_MeshEditor::ElemFeatures elemFeat(type, block.isPoly != 0);
+                elemFeat.SetID(ids[iElem]);
+                editor.AddElement(nodes, elemFeat);
+            }
+        }
+    }
+
+    const uint32_t maxGroupName = 1 << 16;
+    uint32_t nbGroups = 0;
+    str >> nbGroups;
+    for (uint32_t iGroup = 0; iGroup < nbGroups && str; iGroup++) {
+        uint32_t nameLength = 0, groupType = 0, nbMembers = 0;
+        str >> nameLength;
+        if (!str || nameLength > maxGroupName) {
+            throw Base::BadFormatError("Invalid FEM mesh file");
+        }
+        std::string name(nameLength, '\0');
+        str.read(&name[0], static_cast<int>(nameLength));
+        str >> groupType >> nbMembers;
+        readArray(ids, nbMembers);
+
+        int aId = -1;
+        auto type = static_cast<SMDSAbs_ElementType>(groupType);
+        SMESH_Group* group = myMesh->AddGroup(type, name.c_str(), aId);
+        auto groupDS = dynamic_cast<SMESHDS_Group*>(group->GetGroupDS());
+        if (!groupDS) {
+            continue;
+        }
+        SMDS_MeshGroup& smdsGroup = groupDS->SMDSGroup();
+        for (int32_t id : ids) {
+            const SMDS_MeshElement* elem =
+                type == SMDSAbs_Node ? meshDS->FindNode(id) : meshDS->FindElement(id);
+            if (elem) {
+                smdsGroup.Add(elem);
+            }
+        }
+    }
+
+    if (!str) {
+        throw Base::BadFormatError("FEM mesh file is truncated");
+    }
+}
+
 void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 {
     // We perform a translation and rotation of the current active Mesh object
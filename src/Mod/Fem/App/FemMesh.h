@@ -23,8 +23,10 @@
 #ifndef FEM_FEMMESH_H
 #define FEM_FEMMESH_H
 
+#include <cstdint>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <SMDSAbs_ElementType.hxx>
@@ -78,6 +80,8 @@ enum class ABAQUS_EdgeVariant
 
 using SMESH_HypothesisPtr = std::shared_ptr<SMESH_Hypothesis>;
 
+class FemMeshNodeTree;
+
 /** The representation of a FemMesh
  */
 class FemExport FemMesh: public Data::ComplexGeoData
@@ -128,14 +132,14 @@ public:
     //@{
     /// retrieving by region growing
     std::set<long> getSurfaceNodes(long ElemId, short FaceId, float Angle = 360) const;
-    /// retrieving by solid
-    std::set<int> getNodesBySolid(const TopoDS_Solid& solid) const;
+    /// retrieving by solid, the node IDs are sorted
+    std::vector<int> getNodesBySolid(const TopoDS_Solid& solid) const;
     /// retrieving by face
-    std::set<int> getNodesByFace(const TopoDS_Face& face) const;
+    std::vector<int> getNodesByFace(const TopoDS_Face& face) const;
     /// retrieving by edge
-    std::set<int> getNodesByEdge(const TopoDS_Edge& edge) const;
+    std::vector<int> getNodesByEdge(const TopoDS_Edge& edge) const;
     /// retrieving by vertex
-    std::set<int> getNodesByVertex(const TopoDS_Vertex& vertex) const;
+    std::vector<int> getNodesByVertex(const TopoDS_Vertex& vertex) const;
     /// retrieving node IDs by element ID
     std::list<int> getElementNodes(int id) const;
     /// retrieving elements IDs by node ID
@@ -218,6 +222,14 @@ private:
     void readNastran95(const std::string& Filename);
     void readZ88(const std::string& Filename);
     void readAbaqus(const std::string& Filename);
+    bool saveBinary() const;
+    void writeBinary(std::ostream&) const;
+    void readBinary(std::istream&);
+    /// kd-tree of the nodes in global coordinates, rebuilt when the SMESH mesh reports a
+    /// modification or the placement changes
+    std::shared_ptr<const FemMeshNodeTree> getNodeTree() const;
+    /// modification time stamp of the SMESH mesh data
+    std::uint64_t getModificationTime() const;
 
 private:
     /// positioning matrix
@@ -226,6 +238,11 @@ private:
     const int myStudyId;
 
     std::list<SMESH_HypothesisPtr> hypoth;
+
+    mutable std::mutex nodeTreeMutex;
+    mutable std::shared_ptr<const FemMeshNodeTree> nodeTree;
+    mutable std::uint64_t nodeTreeTime = 0;
+    mutable Base::Matrix4D nodeTreeMatrix;
     static SMESH_Gen* _mesh_gen;
 };
 
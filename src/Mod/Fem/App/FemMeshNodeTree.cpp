@@ -0,0 +1,106 @@
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <numeric>
+#endif
+
+#include "FemMeshNodeTree.h"
+
+
+using namespace Fem;
+
+FemMeshNodeTree::FemMeshNodeTree(std::vector<int> ids, std::vector<Base::Vector3d> points)
+{
+    // sort an index array and apply it at the end, so ids and points stay together
+    std::vector<std::size_t> order(points.size());
+    std::iota(order.begin(), order.end(), 0);
+    this->ids.swap(ids);
+    this->points.swap(points);
+
+    struct Builder
+    {
+        const std::vector<Base::Vector3d>& points;
+        std::vector<std::size_t>& order;
+
+        void build(std::size_t begin, std::size_t end, int axis)
+        {
+            while (end - begin > 1) {
+                std::size_t mid = begin + (end - begin) / 2;
+                std::nth_element(order.begin() + begin,
+                                 order.begin() + mid,
+                                 order.begin() + end,
+                                 [this, axis](std::size_t a, std::size_t b) {
+                                     return points[a][axis] < points[b][axis];
+                                 });
+                int next = (axis + 1) % 3;
+                build(begin, mid, next);
+                begin = mid + 1;
+                axis = next;
+            }
+        }
+    };
+
+    Builder builder {this->points, order};
+    builder.build(0, order.size(), 0);
+
+    std::vector<int> sortedIds(order.size());
+    std::vector<Base::Vector3d> sortedPoints(order.size());
+    for (std::size_t i = 0; i < order.size(); i++) {
+        sortedIds[i] = this->ids[order[i]];
+        sortedPoints[i] = this->points[order[i]];
+    }
+    this->ids.swap(sortedIds);
+    this->points.swap(sortedPoints);
+}
+
+std::vector<int> FemMeshNodeTree::findInBox(const Base::BoundBox3d& box) const
+{
+    std::vector<int> result;
+    visitBox(box, [&](std::size_t index) {
+        result.push_back(ids[index]);
+    });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<int> FemMeshNodeTree::findInSphere(const Base::Vector3d& center, double radius) const
+{
+    std::vector<int> result;
+    Base::BoundBox3d box(center.x - radius,
+                         center.y - radius,
+                         center.z - radius,
+                         center.x + radius,
+                         center.y + radius,
+                         center.z + radius);
+    double radius2 = radius * radius;
+    visitBox(box, [&](std::size_t index) {
+        if (Base::DistanceP2(center, points[index]) <= radius2) {
+            result.push_back(ids[index]);
+        }
+    });
+    std::sort(result.begin(), result.end());
+    return result;
+}
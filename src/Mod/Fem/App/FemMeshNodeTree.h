@@ -0,0 +1,120 @@
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef FEM_FEMMESHNODETREE_H
+#define FEM_FEMMESHNODETREE_H
+
+#include <cstddef>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+
+namespace Fem
+{
+
+/*!
+ A static kd-tree over the nodes of a FemMesh, in the global coordinates of
+ the mesh. The tree is stored implicitly: the points are reordered so that the
+ median of every range splits it, and no child pointers are kept.
+ */
+class FemMeshNodeTree
+{
+public:
+    FemMeshNodeTree(std::vector<int> ids, std::vector<Base::Vector3d> points);
+
+    std::size_t size() const
+    {
+        return points.size();
+    }
+    int id(std::size_t index) const
+    {
+        return ids[index];
+    }
+    const Base::Vector3d& point(std::size_t index) const
+    {
+        return points[index];
+    }
+
+    /// calls \a func with the index of every point inside \a box
+    template<typename Func>
+    void visitBox(const Base::BoundBox3d& box, Func&& func) const
+    {
+        if (!points.empty()) {
+            visitBox(box, func, 0, points.size(), 0);
+        }
+    }
+    /// returns the sorted ids of the points inside \a box
+    std::vector<int> findInBox(const Base::BoundBox3d& box) const;
+    /// returns the sorted ids of the points not farther than \a radius from \a center
+    std::vector<int> findInSphere(const Base::Vector3d& center, double radius) const;
+
+private:
+    template<typename Func>
+    void visitBox(const Base::BoundBox3d& box,
+                  Func& func,
+                  std::size_t begin,
+                  std::size_t end,
+                  int axis) const
+    {
+        while (begin < end) {
+            std::size_t mid = begin + (end - begin) / 2;
+            const Base::Vector3d& pnt = points[mid];
+            if (box.IsInBox(pnt)) {
+                func(mid);
+            }
+            double value = pnt[axis];
+            int next = (axis + 1) % 3;
+            bool left = minimum(box, axis) <= value;
+            bool right = maximum(box, axis) >= value;
+            if (left && right) {
+                visitBox(box, func, begin, mid, next);
+                begin = mid + 1;
+            }
+            else if (left) {
+                end = mid;
+            }
+            else {
+                begin = mid + 1;
+            }
+            axis = next;
+        }
+    }
+    static double minimum(const Base::BoundBox3d& box, int axis)
+    {
+        return axis == 0 ? box.MinX : (axis == 1 ? box.MinY : box.MinZ);
+    }
+    static double maximum(const Base::BoundBox3d& box, int axis)
+    {
+        return axis == 0 ? box.MaxX : (axis == 1 ? box.MaxY : box.MaxZ);
+    }
+
+private:
+    std::vector<int> ids;
+    std::vector<Base::Vector3d> points;
+};
+
+}  // namespace Fem
+
+
+#endif  // FEM_FEMMESHNODETREE_H
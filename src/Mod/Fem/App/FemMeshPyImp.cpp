@@ -1401,7 +1401,7 @@ PyObject* FemMeshPy::getNodesBySolid(PyObject* args)
             return nullptr;
         }
         Py::List ret;
-        std::set<int> resultSet = getFemMeshPtr()->getNodesBySolid(fc);
+        std::vector<int> resultSet = getFemMeshPtr()->getNodesBySolid(fc);
         for (int it : resultSet) {
             ret.append(Py::Long(it));
         }
@@ -1430,7 +1430,7 @@ PyObject* FemMeshPy::getNodesByFace(PyObject* args)
             return nullptr;
         }
         Py::List ret;
-        std::set<int> resultSet = getFemMeshPtr()->getNodesByFace(fc);
+        std::vector<int> resultSet = getFemMeshPtr()->getNodesByFace(fc);
         for (int it : resultSet) {
             ret.append(Py::Long(it));
         }
@@ -1459,7 +1459,7 @@ PyObject* FemMeshPy::getNodesByEdge(PyObject* args)
             return nullptr;
         }
         Py::List ret;
-        std::set<int> resultSet = getFemMeshPtr()->getNodesByEdge(fc);
+        std::vector<int> resultSet = getFemMeshPtr()->getNodesByEdge(fc);
         for (int it : resultSet) {
             ret.append(Py::Long(it));
         }
@@ -1488,7 +1488,7 @@ PyObject* FemMeshPy::getNodesByVertex(PyObject* args)
             return nullptr;
         }
         Py::List ret;
-        std::set<int> resultSet = getFemMeshPtr()->getNodesByVertex(fc);
+        std::vector<int> resultSet = getFemMeshPtr()->getNodesByVertex(fc);
         for (int it : resultSet) {
             ret.append(Py::Long(it));
         }
@@ -24,11 +24,14 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <cstring>
 #include <vtkDoubleArray.h>
+#include <vtkInformation.h>
 #include <vtkPointData.h>
 #endif
 
 #include <App/Document.h>
+#include <Base/Console.h>
 
 #include "FemPostFilter.h"
 #include "FemPostPipeline.h"
@@ -66,26 +69,71 @@ void FemPostFilter::setActiveFilterPipeline(std::string name)
 
 DocumentObjectExecReturn* FemPostFilter::execute()
 {
-    if (!m_pipelines.empty() && !m_activePipeline.empty()) {
-        FemPostFilter::FilterPipeline& pipe = m_pipelines[m_activePipeline];
-        vtkSmartPointer<vtkDataObject> data = getInputData();
-        if (!data || !data->IsA("vtkDataSet")) {
-            return StdReturn;
-        }
+    // in parallel mode all filters of the pipeline work on the pipeline data,
+    // the first one to recompute updates all of them concurrently
+    FemPostPipeline* pipeline = getParentPipeline();
+    if (pipeline && pipeline->Mode.getValue() == 1) {
+        pipeline->updateFilters();
+    }
+
+    vtkAlgorithm* target = connectFilterPipeline();
+    if (!target) {
+        return StdReturn;
+    }
+    target->Update();
+
+    // only a regenerated output is published, an unchanged filter keeps its data untouched
+    vtkDataObject* output = target->GetOutputDataObject(0);
+    if (!Data.getValue() || output->GetUpdateTime() != m_outputTime) {
+        m_outputTime = output->GetUpdateTime();
+        Data.setValueShallow(output);
+        Base::Console().Log("%s: %lu kB of output data\n",
+                            getFullName().c_str(),
+                            static_cast<unsigned long>(output->GetActualMemorySize()));
+    }
 
-        if ((m_activePipeline == "DataAlongLine") || (m_activePipeline == "DataAtPoint")) {
-            pipe.filterSource->SetSourceData(getInputData());
-            pipe.filterTarget->Update();
-            Data.setValue(pipe.filterTarget->GetOutputDataObject(0));
+    return StdReturn;
+}
+
+vtkAlgorithm* FemPostFilter::connectFilterPipeline(bool concurrent)
+{
+    if (m_pipelines.empty() || m_activePipeline.empty()) {
+        return nullptr;
+    }
+
+    vtkDataObject* data = getInputData();
+    if (!data || !data->IsA("vtkDataSet")) {
+        return nullptr;
+    }
+
+    FemPostFilter::FilterPipeline& pipe = m_pipelines[m_activePipeline];
+    bool probe = (m_activePipeline == "DataAlongLine") || (m_activePipeline == "DataAtPoint");
+    // a new input object would make VTK run all filters again, so only connect modified data
+    if (data != m_inputSource || data->GetMTime() != m_inputTime
+        || m_activePipeline != m_connectedPipeline || (concurrent && !m_inputCopied)) {
+        m_input.TakeReference(data->NewInstance());
+        if (concurrent) {
+            m_input->DeepCopy(data);
+        }
+        else {
+            m_input->ShallowCopy(data);
+        }
+        m_inputCopied = concurrent;
+        m_inputSource = data;
+        m_inputTime = data->GetMTime();
+        m_connectedPipeline = m_activePipeline;
+        if (probe) {
+            pipe.filterSource->SetSourceData(m_input);
         }
         else {
-            pipe.source->SetInputDataObject(data);
-            pipe.target->Update();
-            Data.setValue(pipe.target->GetOutputDataObject(0));
+            pipe.source->SetInputDataObject(m_input);
         }
     }
 
-    return StdReturn;
+    if (probe) {
+        return pipe.filterTarget;
+    }
+    return pipe.target;
 }
 
 vtkDataObject* FemPostFilter::getInputData()
@@ -102,18 +150,46 @@ vtkDataObject* FemPostFilter::getInputData()
     }
     else {
         // get the pipeline and use the pipelinedata
-        std::vector<App::DocumentObject*> objs =
-            getDocument()->getObjectsOfType(FemPostPipeline::getClassTypeId());
-        for (auto it : objs) {
-            if (static_cast<FemPostPipeline*>(it)->holdsPostObject(this)) {
-                return static_cast<FemPostObject*>(it)->Data.getValue();
-            }
+        if (FemPostPipeline* pipeline = getParentPipeline()) {
+            return pipeline->Data.getValue();
+        }
+    }
+
+    return nullptr;
+}
+
+FemPostPipeline* FemPostFilter::getParentPipeline()
+{
+    std::vector<App::DocumentObject*> objs =
+        getDocument()->getObjectsOfType(FemPostPipeline::getClassTypeId());
+    for (auto it : objs) {
+        if (static_cast<FemPostPipeline*>(it)->holdsPostObject(this)) {
+            return static_cast<FemPostPipeline*>(it);
         }
     }
 
     return nullptr;
 }
 
+namespace
+{
+
+// selects the point array processed by the algorithm unless it is selected already, an
+// algorithm modified without need would run again on the next update
+void setPointArrayToProcess(vtkAlgorithm* algorithm, const char* name)
+{
+    vtkInformation* info = algorithm->GetInputArrayInformation(0);
+    if (info->Has(vtkDataObject::FIELD_NAME())
+        && info->Get(vtkDataObject::FIELD_ASSOCIATION())
+            == vtkDataObject::FIELD_ASSOCIATION_POINTS
+        && std::strcmp(info->Get(vtkDataObject::FIELD_NAME()), name) == 0) {
+        return;
+    }
+    algorithm->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, name);
+}
+
+}  // namespace
+
 // ***************************************************************************
 // in the following, the different filters sorted alphabetically
 // ***************************************************************************
@@ -928,11 +1004,7 @@ void FemPostScalarClipFilter::onChanged(const Property* prop)
         m_clipper->SetInsideOut(InsideOut.getValue());
     }
     else if (prop == &Scalars && (Scalars.getValue() >= 0)) {
-        m_clipper->SetInputArrayToProcess(0,
-                                          0,
-                                          0,
-                                          vtkDataObject::FIELD_ASSOCIATION_POINTS,
-                                          Scalars.getValueAsString());
+        setPointArrayToProcess(m_clipper, Scalars.getValueAsString());
         setConstraintForField();
     }
 
@@ -1044,11 +1116,7 @@ void FemPostWarpVectorFilter::onChanged(const Property* prop)
         m_warp->SetScaleFactor(1000 * Factor.getValue());
     }
     else if (prop == &Vector && (Vector.getValue() >= 0)) {
-        m_warp->SetInputArrayToProcess(0,
-                                       0,
-                                       0,
-                                       vtkDataObject::FIELD_ASSOCIATION_POINTS,
-                                       Vector.getValueAsString());
+        setPointArrayToProcess(m_warp, Vector.getValueAsString());
     }
 
     Fem::FemPostFilter::onChanged(prop);
@@ -43,6 +43,8 @@
 namespace Fem
 {
 
+class FemPostPipeline;
+
 class FemExport FemPostFilter: public Fem::FemPostObject
 {
     PROPERTY_HEADER_WITH_OVERRIDE(Fem::FemPostFilter);
@@ -56,8 +58,20 @@ public:
 
     App::DocumentObjectExecReturn* execute() override;
 
+    /** Connects the active filter pipeline to the input data and returns its last algorithm,
+     * or null if there is no valid input. The VTK filters keep their outputs as long as the
+     * input data isn't modified, so that updating the returned algorithm only runs the filters
+     * whose parameters changed. Every filter object works on its own copy of the input. VTK
+     * caches data like array ranges lazily in the arrays of a shallow copy, so the input is
+     * deep copied if the returned algorithm is to be updated concurrently with others. The
+     * pipeline only does so for inputs below the ConcurrentFilterInputSize preference.
+     */
+    vtkAlgorithm* connectFilterPipeline(bool concurrent = false);
+
 protected:
     vtkDataObject* getInputData();
+    /// the pipeline whose Filter list holds this filter
+    FemPostPipeline* getParentPipeline();
 
     // pipeline handling for derived filter
     struct FilterPipeline
@@ -75,6 +89,14 @@ private:
     // handling of multiple pipelines which can be the filter
     std::map<std::string, FilterPipeline> m_pipelines;
     std::string m_activePipeline;
+
+    // the input the active pipeline is connected to and the output published in Data
+    std::string m_connectedPipeline;
+    vtkSmartPointer<vtkDataObject> m_input;
+    vtkDataObject* m_inputSource {nullptr};
+    vtkMTimeType m_inputTime {0};
+    vtkMTimeType m_outputTime {0};
+    bool m_inputCopied {false};
 };
 
 // ***************************************************************************
@@ -28,6 +28,7 @@
 #include <vtkDataSetReader.h>
 #include <vtkImageData.h>
 #include <vtkRectilinearGrid.h>
+#include <vtkSMPTools.h>
 #include <vtkStructuredGrid.h>
 #include <vtkUnstructuredGrid.h>
 #include <vtkXMLImageDataReader.h>
@@ -38,6 +39,7 @@
 #include <vtkXMLUnstructuredGridReader.h>
 #endif
 
+#include <App/Application.h>
 #include <Base/Console.h>
 
 #include "FemMesh.h"
@@ -98,25 +100,35 @@ DocumentObjectExecReturn* FemPostPipeline::execute()
 
     // now if we are a filter than our data object is created by the filter we hold
 
-    // if we are in serial mode we just copy over the data of the last filter,
+    // if we are in serial mode we just share the data of the last filter,
     // but if we are in parallel we need to combine all filter results
     if (Mode.getValue() == 0) {
         // serial
-        Data.setValue(getLastPostObject()->Data.getValue());
+        Data.setValueShallow(getLastPostObject()->Data.getValue());
     }
     else if (Mode.getValue() == 1) {
         // parallel, go through all filters and append the result
-        const std::vector<App::DocumentObject*>& filters = Filter.getValues();
-        std::vector<App::DocumentObject*>::const_iterator it = filters.begin();
-
-        vtkSmartPointer<vtkAppendFilter> append = vtkSmartPointer<vtkAppendFilter>::New();
-        for (; it != filters.end(); ++it) {
-
-            append->AddInputDataObject(static_cast<FemPostObject*>(*it)->Data.getValue());
+        std::vector<vtkDataObject*> inputs;
+        for (auto it : Filter.getValues()) {
+            inputs.push_back(static_cast<FemPostObject*>(it)->Data.getValue());
         }
 
-        append->Update();
-        Data.setValue(append->GetOutputDataObject(0));
+        // every new filter result is a new data object, so unchanged inputs mean an unchanged
+        // result, and the appended data is kept
+        if (!m_append || inputs != m_appendInputs) {
+            m_append = vtkSmartPointer<vtkAppendFilter>::New();
+            for (auto it : inputs) {
+                m_append->AddInputDataObject(it);
+            }
+            m_appendInputs = inputs;
+
+            m_append->Update();
+            Data.setValueShallow(m_append->GetOutputDataObject(0));
+            Base::Console().Log(
+                "%s: %lu kB of output data\n",
+                getFullName().c_str(),
+                static_cast<unsigned long>(m_append->GetOutputDataObject(0)->GetActualMemorySize()));
+        }
     }
 
     return Fem::FemPostObject::execute();
@@ -266,6 +278,50 @@ FemPostObject* FemPostPipeline::getLastPostObject()
     return static_cast<FemPostObject*>(Filter.getValues().back());
 }
 
+void FemPostPipeline::updateFilters()
+{
+    std::vector<FemPostFilter*> filters;
+    for (auto it : Filter.getValues()) {
+        auto filter = static_cast<FemPostFilter*>(it);
+        if (filter->mustRecompute()) {
+            filters.push_back(filter);
+        }
+    }
+    if (filters.size() < 2) {
+        return;
+    }
+
+    // Every concurrently updated filter needs its own deep copy of the input. Large inputs are
+    // shared by filters updated one after another instead, each in its own execute().
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Fem/General");
+    unsigned long limit = hGrp->GetUnsigned("ConcurrentFilterInputSize", 64) * 1024;  // kB
+    vtkDataObject* data = Data.getValue();
+    if (!data || data->GetActualMemorySize() > limit) {
+        return;
+    }
+
+    // connecting the filters accesses the document, hence it is done one after another
+    std::vector<vtkAlgorithm*> algorithms;
+    for (auto filter : filters) {
+        if (vtkAlgorithm* algorithm = filter->connectFilterPipeline(true)) {
+            algorithms.push_back(algorithm);
+        }
+    }
+    if (algorithms.size() < 2) {
+        return;
+    }
+
+    // the filters work on deep copies of the input and never share a data object, the
+    // recompute of each filter then only publishes its output
+    auto update = [&algorithms](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; i++) {
+            algorithms[i]->Update();
+        }
+    };
+    vtkSMPTools::For(0, static_cast<vtkIdType>(algorithms.size()), 1, update);
+}
+
 bool FemPostPipeline::holdsPostObject(FemPostObject* obj)
 {
 
@@ -28,6 +28,7 @@
 #include "FemPostObject.h"
 #include "FemResultObject.h"
 
+#include <vtkAppendFilter.h>
 #include <vtkSmartPointer.h>
 
 
@@ -68,6 +69,8 @@ public:
     void recomputeChildren();
     FemPostObject* getLastPostObject();
     bool holdsPostObject(FemPostObject* obj);
+    /// updates the VTK filters of all filters that need a recompute concurrently
+    void updateFilters();
 
 protected:
     void onChanged(const App::Property* prop) override;
@@ -75,6 +78,10 @@ protected:
 private:
     static const char* ModeEnums[];
 
+    // combines the filter results in parallel mode
+    vtkSmartPointer<vtkAppendFilter> m_append;
+    std::vector<vtkDataObject*> m_appendInputs;
+
     template<class TReader>
     void readXMLFile(std::string file)
     {
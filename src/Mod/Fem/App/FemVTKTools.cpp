@@ -29,6 +29,7 @@
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
@@ -55,6 +56,7 @@
 #include <vtkTriangle.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkUnstructuredGrid.h>
+#include <vtkVersionMacros.h>
 #include <vtkWedge.h>
 #include <vtkXMLPUnstructuredGridReader.h>
 #include <vtkXMLUnstructuredGridReader.h>
@@ -862,6 +864,26 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset,
         }
     }
 
+    // result fields take the point data array of the same name as it is
+    std::vector<App::Property*> props;
+    result->getPropertyList(props);
+    for (auto prop : props) {
+        auto field = dynamic_cast<PropertyResultField*>(prop);
+        if (!field) {
+            continue;
+        }
+        vtkDataArray* array = pd->GetArray(prop->getName());
+        if (!array || array->GetNumberOfTuples() != nPoints) {
+            Base::Console().Message("    PropertyResultField NOT found in vtk file data: %s\n",
+                                    prop->getName());
+            continue;
+        }
+        field->setLayout(array->GetNumberOfComponents(), nPoints);
+        field->setStep(ts, shareVTKArray(array));
+        Base::Console().Log("    A PropertyResultField has been filled with values: %s\n",
+                            prop->getName());
+    }
+
     // stats
     // stats are added by importVTKResults
 
@@ -1020,7 +1042,89 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result,
         }
     }
 
+    // result fields are stored in the point order of the grid and are not scaled, so their
+    // values are handed over as they are
+    std::vector<App::Property*> props;
+    res->getPropertyList(props);
+    for (auto prop : props) {
+        auto field = dynamic_cast<const PropertyResultField*>(prop);
+        if (!field || field->getNumSteps() == 0) {
+            continue;
+        }
+        if (field->getNumTuples() != static_cast<std::size_t>(nPoints)) {
+            Base::Console().Log("    PropertyResultField NOT exported to vtk: %s size is: %i\n",
+                                prop->getName(),
+                                static_cast<int>(field->getNumTuples()));
+            continue;
+        }
+        std::size_t step = field->findStep(res->Time.getValue());
+        vtkSmartPointer<vtkDoubleArray> data = shareResultField(*field, step);
+        data->SetName(prop->getName());
+        grid->GetPointData()->AddArray(data);
+        Base::Console().Log("    The PropertyResultField %s was exported to VTK\n",
+                            prop->getName());
+    }
+
     Base::Console().Log("End: Create VTK result data from FreeCAD result data.\n");
 }
 
+namespace
+{
+// The buffers of result fields used by VTK arrays. VTK releases an array with a plain function
+// that only gets the pointer, so the owners are looked up here.
+std::mutex sharedBufferMutex;
+std::map<const void*, std::vector<PropertyResultField::Buffer>> sharedBuffers;
+
+void releaseSharedBuffer(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(sharedBufferMutex);
+    auto it = sharedBuffers.find(ptr);
+    if (it != sharedBuffers.end()) {
+        it->second.pop_back();
+        if (it->second.empty()) {
+            sharedBuffers.erase(it);
+        }
+    }
+}
+}  // namespace
+
+vtkSmartPointer<vtkDoubleArray> FemVTKTools::shareResultField(const PropertyResultField& field,
+                                                              std::size_t step)
+{
+    vtkSmartPointer<vtkDoubleArray> data = vtkSmartPointer<vtkDoubleArray>::New();
+    data->SetNumberOfComponents(field.getComponents());
+    const PropertyResultField::Buffer& buffer = field.getBuffer(step);
+    vtkIdType size = static_cast<vtkIdType>(field.getNumTuples() * field.getComponents());
+    if (size == 0) {
+        return data;
+    }
+#if VTK_MAJOR_VERSION >= 9
+    {
+        std::lock_guard<std::mutex> lock(sharedBufferMutex);
+        sharedBuffers[buffer.get()].push_back(buffer);
+    }
+    // the buffer is const, but VTK filters do not write into the arrays of their input
+    data->SetArray(const_cast<double*>(buffer.get()),
+                   size,
+                   0,
+                   vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+    data->SetArrayFreeFunction(releaseSharedBuffer);
+#else
+    data->SetNumberOfTuples(static_cast<vtkIdType>(field.getNumTuples()));
+    std::copy(buffer.get(), buffer.get() + size, data->GetPointer(0));
+#endif
+    return data;
+}
+
+PropertyResultField::Buffer FemVTKTools::shareVTKArray(vtkDataArray* array)
+{
+    vtkSmartPointer<vtkDoubleArray> doubles = vtkDoubleArray::SafeDownCast(array);
+    if (!doubles) {
+        doubles = vtkSmartPointer<vtkDoubleArray>::New();
+        doubles->DeepCopy(array);
+    }
+    // the deleter holds a reference to the array as long as the buffer is used
+    return PropertyResultField::Buffer(doubles->GetPointer(0), [doubles](const double*) {});
+}
+
 }  // namespace Fem
@@ -24,12 +24,14 @@
 #define FEM_VTK_TOOLS_H
 
 #include <vtkDataSet.h>
+#include <vtkDoubleArray.h>
 #include <vtkSmartPointer.h>
 #include <vtkUnstructuredGrid.h>
 
 #include <App/DocumentObject.h>
 
 #include "FemMeshObject.h"
+#include "PropertyResultField.h"
 
 
 namespace Fem
@@ -57,6 +59,14 @@ public:
     static void exportFreeCADResult(const App::DocumentObject* result,
                                     vtkSmartPointer<vtkDataSet> grid);
 
+    // VTK array using the values of one step of a result field, the values are not copied
+    static vtkSmartPointer<vtkDoubleArray> shareResultField(const PropertyResultField& field,
+                                                            std::size_t step);
+
+    // buffer for a result field using the values of a VTK array, the values are not copied
+    // unless the array does not hold doubles
+    static PropertyResultField::Buffer shareVTKArray(vtkDataArray* array);
+
     // FemMesh read from vtkUnstructuredGrid data file
     static FemMesh* readVTKMesh(const char* filename, FemMesh* mesh);
 
@@ -123,6 +123,21 @@ void PropertyPostDataObject::setValue(const vtkSmartPointer<vtkDataObject>& ds)
     hasSetValue();
 }
 
+void PropertyPostDataObject::setValueShallow(const vtkSmartPointer<vtkDataObject>& ds)
+{
+    aboutToSetValue();
+
+    if (ds) {
+        createDataObjectByExternalType(ds);
+        m_dataObject->ShallowCopy(ds);
+    }
+    else {
+        m_dataObject = nullptr;
+    }
+
+    hasSetValue();
+}
+
 const vtkSmartPointer<vtkDataObject>& PropertyPostDataObject::getValue() const
 {
     return m_dataObject;
@@ -50,6 +50,8 @@ public:
     void scale(double s);
     /// set the dataset
     void setValue(const vtkSmartPointer<vtkDataObject>&);
+    /// set the dataset, sharing its points, cells and arrays instead of copying them
+    void setValueShallow(const vtkSmartPointer<vtkDataObject>&);
     /// get the part shape
     const vtkSmartPointer<vtkDataObject>& getValue() const;
     /// check if we hold a dataset or a dataobject (which would mean a composite data structure)
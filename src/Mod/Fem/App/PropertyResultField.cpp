@@ -0,0 +1,319 @@
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cstring>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/GeometryPyCXX.h>
+#include <Base/Reader.h>
+#include <Base/Stream.h>
+#include <Base/VectorPy.h>
+#include <Base/Writer.h>
+
+#include "PropertyResultField.h"
+
+
+using namespace Fem;
+
+TYPESYSTEM_SOURCE(Fem::PropertyResultField, App::Property)
+
+PropertyResultField::PropertyResultField() = default;
+
+PropertyResultField::~PropertyResultField() = default;
+
+std::size_t PropertyResultField::findStep(double time) const
+{
+    auto it = std::upper_bound(times.begin(), times.end(), time);
+    return it == times.begin() ? 0 : std::size_t(it - times.begin()) - 1;
+}
+
+void PropertyResultField::setLayout(int components, std::size_t tuples)
+{
+    if (components < 1) {
+        throw Base::ValueError("A result field needs at least one component");
+    }
+    aboutToSetValue();
+    this->components = components;
+    this->tuples = tuples;
+    times.clear();
+    steps.clear();
+    hasSetValue();
+}
+
+void PropertyResultField::setStep(double time, Buffer values)
+{
+    if (!values && tuples > 0) {
+        throw Base::ValueError("Missing values of result field step");
+    }
+    aboutToSetValue();
+    insertStep(time, std::move(values));
+    hasSetValue();
+}
+
+void PropertyResultField::setStep(double time, std::vector<double>&& values)
+{
+    Buffer buffer = toBuffer(std::move(values));
+    aboutToSetValue();
+    insertStep(time, std::move(buffer));
+    hasSetValue();
+}
+
+PropertyResultField::Buffer PropertyResultField::toBuffer(std::vector<double>&& values) const
+{
+    if (values.size() != tuples * components) {
+        throw Base::ValueError("Size of result field step does not match its layout");
+    }
+    // the buffer points into the vector, which is moved and not copied
+    auto holder = std::make_shared<std::vector<double>>(std::move(values));
+    return Buffer(holder, holder->data());
+}
+
+void PropertyResultField::insertStep(double time, Buffer values)
+{
+    auto it = std::lower_bound(times.begin(), times.end(), time);
+    std::size_t index = it - times.begin();
+    if (it != times.end() && *it == time) {
+        steps[index] = std::move(values);
+    }
+    else {
+        times.insert(it, time);
+        steps.insert(steps.begin() + index, std::move(values));
+    }
+}
+
+PyObject* PropertyResultField::getPyObject()
+{
+    Py::List list;
+    for (std::size_t step = 0; step < steps.size(); step++) {
+        const double* values = steps[step].get();
+        Py::List stepValues(static_cast<int>(tuples));
+        for (std::size_t i = 0; i < tuples; i++) {
+            const double* tuple = values + i * components;
+            if (components == 1) {
+                stepValues[i] = Py::Float(tuple[0]);
+            }
+            else if (components == 3) {
+                stepValues[i] = Py::Vector(Base::Vector3d(tuple[0], tuple[1], tuple[2]));
+            }
+            else {
+                Py::Tuple item(components);
+                for (int j = 0; j < components; j++) {
+                    item[j] = Py::Float(tuple[j]);
+                }
+                stepValues[i] = item;
+            }
+        }
+        list.append(Py::TupleN(Py::Float(times[step]), stepValues));
+    }
+    return Py::new_reference_to(list);
+}
+
+void PropertyResultField::setPyObject(PyObject* value)
+{
+    // a list of (time, values) tuples, the values are floats, vectors or tuples of floats
+    if (!PySequence_Check(value)) {
+        std::string error = std::string("type must be a list of (time, values), not ");
+        error += value->ob_type->tp_name;
+        throw Base::TypeError(error);
+    }
+
+    auto tupleSize = [](const Py::Object& item) -> int {
+        if (PyObject_TypeCheck(item.ptr(), &Base::VectorPy::Type)) {
+            return 3;
+        }
+        if (PyNumber_Check(item.ptr())) {
+            return 1;
+        }
+        return static_cast<int>(Py::Sequence(item).size());
+    };
+
+    Py::Sequence list(value);
+    int newComponents = 1;
+    std::size_t newTuples = 0;
+    std::vector<double> newTimes;
+    std::vector<std::vector<double>> newSteps;
+    for (Py::Sequence::size_type step = 0; step < list.size(); step++) {
+        Py::Sequence pair(list[step]);
+        if (pair.size() != 2) {
+            throw Base::TypeError("Result field steps must be (time, values) tuples");
+        }
+        Py::Sequence items(pair[1]);
+        if (step == 0) {
+            newTuples = items.size();
+            newComponents = newTuples > 0 ? tupleSize(items[0]) : 1;
+            if (newComponents < 1) {
+                throw Base::ValueError("A result field needs at least one component");
+            }
+        }
+        if (items.size() != static_cast<Py::Sequence::size_type>(newTuples)) {
+            throw Base::ValueError("All steps of a result field must have the same size");
+        }
+
+        std::vector<double> values;
+        values.reserve(newTuples * newComponents);
+        for (Py::Sequence::size_type i = 0; i < items.size(); i++) {
+            Py::Object item(items[i]);
+            if (tupleSize(item) != newComponents) {
+                throw Base::ValueError("All values of a result field must have the same size");
+            }
+            if (PyObject_TypeCheck(item.ptr(), &Base::VectorPy::Type)) {
+                Base::Vector3d vec = static_cast<Base::VectorPy*>(item.ptr())->value();
+                values.insert(values.end(), {vec.x, vec.y, vec.z});
+            }
+            else if (newComponents == 1 && PyNumber_Check(item.ptr())) {
+                values.push_back(static_cast<double>(Py::Float(item)));
+            }
+            else {
+                Py::Sequence tuple(item);
+                for (int j = 0; j < newComponents; j++) {
+                    values.push_back(static_cast<double>(Py::Float(tuple[j])));
+                }
+            }
+        }
+        newTimes.push_back(static_cast<double>(Py::Float(pair[0])));
+        newSteps.push_back(std::move(values));
+    }
+
+    aboutToSetValue();
+    components = newComponents;
+    tuples = newTuples;
+    times.clear();
+    steps.clear();
+    for (std::size_t step = 0; step < newSteps.size(); step++) {
+        insertStep(newTimes[step], toBuffer(std::move(newSteps[step])));
+    }
+    hasSetValue();
+}
+
+void PropertyResultField::Save(Base::Writer& writer) const
+{
+    writer.Stream() << writer.ind() << "<ResultField components=\"" << components
+                    << "\" tuples=\"" << tuples << "\" file=\""
+                    << (steps.empty() ? "" : writer.addFile(getName(), this)) << "\"/>"
+                    << std::endl;
+}
+
+void PropertyResultField::Restore(Base::XMLReader& reader)
+{
+    reader.readElement("ResultField");
+    aboutToSetValue();
+    components = static_cast<int>(reader.getAttributeAsInteger("components"));
+    tuples = reader.getAttributeAsUnsigned("tuples");
+    times.clear();
+    steps.clear();
+    hasSetValue();
+
+    std::string file(reader.getAttribute("file"));
+    if (!file.empty()) {
+        // initiate a file read
+        reader.addFile(file.c_str(), this);
+    }
+}
+
+void PropertyResultField::SaveDocFile(Base::Writer& writer) const
+{
+    Base::OutputStream str(writer.Stream());
+    str << static_cast<uint32_t>(steps.size());
+    std::size_t count = tuples * components;
+    for (std::size_t step = 0; step < steps.size(); step++) {
+        str << times[step];
+        const double* values = steps[step].get();
+        for (std::size_t i = 0; i < count; i++) {
+            str << values[i];
+        }
+    }
+}
+
+void PropertyResultField::RestoreDocFile(Base::Reader& reader)
+{
+    Base::InputStream str(reader);
+    uint32_t numSteps = 0;
+    str >> numSteps;
+    std::size_t count = tuples * components;
+
+    aboutToSetValue();
+    for (uint32_t step = 0; step < numSteps && str; step++) {
+        double time = 0.0;
+        str >> time;
+        std::vector<double> values(count);
+        for (double& it : values) {
+            str >> it;
+        }
+        insertStep(time, toBuffer(std::move(values)));
+    }
+    hasSetValue();
+}
+
+App::Property* PropertyResultField::Copy() const
+{
+    auto prop = new PropertyResultField();
+    prop->components = components;
+    prop->tuples = tuples;
+    prop->times = times;
+    prop->steps = steps;
+    return prop;
+}
+
+void PropertyResultField::Paste(const App::Property& from)
+{
+    const auto& other = dynamic_cast<const PropertyResultField&>(from);
+    aboutToSetValue();
+    components = other.components;
+    tuples = other.tuples;
+    times = other.times;
+    steps = other.steps;
+    hasSetValue();
+}
+
+unsigned int PropertyResultField::getMemSize() const
+{
+    return static_cast<unsigned int>(steps.size() * tuples * components * sizeof(double)
+                                     + times.size() * sizeof(double));
+}
+
+bool PropertyResultField::isSame(const App::Property& other) const
+{
+    if (&other == this) {
+        return true;
+    }
+    if (other.getTypeId() != getTypeId()) {
+        return false;
+    }
+    const auto& field = static_cast<const PropertyResultField&>(other);
+    if (field.components != components || field.tuples != tuples || field.times != times) {
+        return false;
+    }
+    std::size_t bytes = tuples * components * sizeof(double);
+    for (std::size_t step = 0; step < steps.size(); step++) {
+        const double* a = steps[step].get();
+        const double* b = field.steps[step].get();
+        if (a != b && bytes > 0 && std::memcmp(a, b, bytes) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
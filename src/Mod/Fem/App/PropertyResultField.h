@@ -0,0 +1,124 @@
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef FEM_PROPERTYRESULTFIELD_H
+#define FEM_PROPERTYRESULTFIELD_H
+
+#include <memory>
+#include <vector>
+
+#include <App/Property.h>
+#include <Mod/Fem/FemGlobal.h>
+
+
+namespace Fem
+{
+
+/** A result field with one value array per time step.
+ * Every step holds getComponents() values for each of the getNumTuples() nodes in one
+ * contiguous array, node by node. Tuple i belongs to the node with ID i + 1, which is the point
+ * order of the VTK grid built from the mesh, so the arrays can be handed to VTK as they are.
+ * The arrays are shared and never modified: copying the property, undo and redo only copy
+ * references.
+ */
+class FemExport PropertyResultField: public App::Property
+{
+    TYPESYSTEM_HEADER_WITH_OVERRIDE();
+
+public:
+    using Buffer = std::shared_ptr<const double>;
+
+    PropertyResultField();
+    ~PropertyResultField() override;
+
+    /** @name Getter/setter */
+    //@{
+    /// number of values per node, 1 for scalars, 3 for vectors, 6 for symmetric tensors
+    int getComponents() const
+    {
+        return components;
+    }
+    /// number of nodes of every step
+    std::size_t getNumTuples() const
+    {
+        return tuples;
+    }
+    std::size_t getNumSteps() const
+    {
+        return steps.size();
+    }
+    /// the times of the steps in increasing order
+    const std::vector<double>& getTimes() const
+    {
+        return times;
+    }
+    /// index of the last step whose time is not greater than \a time, or 0 if there is none
+    std::size_t findStep(double time) const;
+    const double* getValues(std::size_t step) const
+    {
+        return steps[step].get();
+    }
+    const Buffer& getBuffer(std::size_t step) const
+    {
+        return steps[step];
+    }
+    /// removes all steps and sets the layout of the following ones
+    void setLayout(int components, std::size_t tuples);
+    /// adds the step at \a time, or replaces the step with that time. The array is shared.
+    void setStep(double time, Buffer values);
+    void setStep(double time, std::vector<double>&& values);
+    //@}
+
+    /** @name Python interface */
+    //@{
+    PyObject* getPyObject() override;
+    void setPyObject(PyObject* value) override;
+    //@}
+
+    /** @name Save/restore */
+    //@{
+    void Save(Base::Writer& writer) const override;
+    void Restore(Base::XMLReader& reader) override;
+    void SaveDocFile(Base::Writer& writer) const override;
+    void RestoreDocFile(Base::Reader& reader) override;
+
+    App::Property* Copy() const override;
+    void Paste(const App::Property& from) override;
+    unsigned int getMemSize() const override;
+    bool isSame(const App::Property& other) const override;
+    //@}
+
+private:
+    Buffer toBuffer(std::vector<double>&& values) const;
+    void insertStep(double time, Buffer values);
+
+private:
+    int components {1};
+    std::size_t tuples {0};
+    std::vector<double> times;
+    std::vector<Buffer> steps;
+};
+
+}  // namespace Fem
+
+
+#endif  // FEM_PROPERTYRESULTFIELD_H
@@ -262,6 +262,17 @@ def read_frd_result(frd_input):
             inout_nodes.append(a)
         f.close()
         Console.PrintMessage(f"{inout_nodes}\n")
+    else:
+        # the C++ reader knows everything but the node numbering of 1D flow networks
+        import Fem
+
+        m = Fem.readFrdResult(frd_input)
+        results = m["Results"]
+        if results and ("mflow" in results[0] or "npressure" in results[0]):
+            Console.PrintError("We have mflow or npressure, but no inout_nodes file.\n")
+        if not m["Nodes"]:
+            Console.PrintError("FEM: No nodes found in Frd file.\n")
+        return m
     frd_file = pyopen(frd_input, "r")
     nodes = {}
     elements_hexa8 = {}
@@ -156,6 +156,95 @@ class TestMeshCommon(unittest.TestCase):
             "Nodes order of quadratic volume element is unexpected",
         )
 
+    # ********************************************************************************************
+    def test_nodes_by_shape(self):
+        import math
+        import Part
+
+        # grid of nodes on a cube of size 2 and nodes on and inside a cylinder of radius 1
+        fm = Fem.FemMesh()
+        node_id = 1
+        for x in range(3):
+            for y in range(3):
+                for z in range(3):
+                    fm.addNode(x, y, z, node_id)
+                    node_id += 1
+        on_cylinder = []
+        for i in range(12):
+            angle = i * math.pi / 6
+            for z in range(3):
+                fm.addNode(10 + math.cos(angle), math.sin(angle), z, node_id)
+                on_cylinder.append(node_id)
+                node_id += 1
+                fm.addNode(10 + 0.9 * math.cos(angle), 0.9 * math.sin(angle), z, node_id)
+                node_id += 1
+
+        def grid_ids(cond):
+            return sorted(n for n, v in fm.Nodes.items() if n < 28 and cond(v))
+
+        box = Part.makeBox(2, 2, 2)
+        bottom = [f for f in box.Faces if f.CenterOfMass.z < 1e-7][0]
+        self.assertEqual(fm.getNodesByFace(bottom), grid_ids(lambda v: v.z == 0))
+        edge_center = FreeCAD.Vector(1, 0, 0)
+        edge = [e for e in box.Edges if e.CenterOfMass.distanceToPoint(edge_center) < 1e-7][0]
+        self.assertEqual(fm.getNodesByEdge(edge), grid_ids(lambda v: v.y == 0 and v.z == 0))
+        vertex = [v for v in box.Vertexes if v.Point.Length < 1e-7][0]
+        self.assertEqual(fm.getNodesByVertex(vertex), [1])
+        self.assertEqual(fm.getNodesBySolid(box.Solids[0]), grid_ids(lambda v: True))
+
+        cylinder = Part.makeCylinder(1, 2, FreeCAD.Vector(10, 0, 0))
+        lateral = [f for f in cylinder.Faces if f.Surface.TypeId == "Part::GeomCylinder"][0]
+        self.assertEqual(fm.getNodesByFace(lateral), on_cylinder)
+
+        # the nodes are looked up in global coordinates
+        fm.Placement = FreeCAD.Placement(FreeCAD.Vector(0, 0, 1), FreeCAD.Rotation())
+        self.assertEqual(fm.getNodesByFace(bottom), [])
+        self.assertEqual(fm.getNodesByVertex(vertex), [])
+
+        # modifying the mesh updates the lookup
+        fm.Placement = FreeCAD.Placement()
+        fm.addNode(0, 0, 0, node_id)
+        self.assertEqual(fm.getNodesByVertex(vertex), [1, node_id])
+
+    # ********************************************************************************************
+    def test_document_save_load(self):
+        from femexamples.meshes.mesh_canticcx_tetra10 import create_elements
+        from femexamples.meshes.mesh_canticcx_tetra10 import create_nodes
+
+        fm = Fem.FemMesh()
+        create_nodes(fm)
+        create_elements(fm)
+        grp = fm.addGroup("MyVolumeGroup", "Volume")
+        fm.addGroupElements(grp, list(fm.Volumes[:10]))
+
+        mesh_obj = self.document.addObject("Fem::FemMeshObject", "Mesh")
+        mesh_obj.FemMesh = fm
+        file_path = join(testtools.get_fem_test_tmp_dir("mesh_common_doc_save"), "mesh.FCStd")
+        # the binary mesh file is opt-in
+        param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Fem/General")
+        previous = param.GetBool("BinaryMeshFile", False)
+        param.SetBool("BinaryMeshFile", True)
+        try:
+            self.document.saveAs(file_path)
+        finally:
+            param.SetBool("BinaryMeshFile", previous)
+        FreeCAD.closeDocument(self.document.Name)
+
+        self.document = FreeCAD.openDocument(file_path)
+        newmesh = self.document.getObject("Mesh").FemMesh
+        self.assertEqual(newmesh.Nodes, fm.Nodes, "Nodes differ after reopening the document")
+        self.assertEqual(newmesh.Volumes, fm.Volumes, "Volumes differ after reopening")
+        self.assertEqual(
+            [newmesh.getElementNodes(e) for e in newmesh.Volumes],
+            [fm.getElementNodes(e) for e in fm.Volumes],
+            "Volume nodes differ after reopening the document",
+        )
+        self.assertEqual(
+            [(newmesh.getGroupName(g), newmesh.getGroupElements(g)) for g in newmesh.Groups],
+            [(fm.getGroupName(g), fm.getGroupElements(g)) for g in fm.Groups],
+            "Groups differ after reopening the document",
+        )
+
     # ********************************************************************************************
     def test_writeAbaqus_precision(self):
         # https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
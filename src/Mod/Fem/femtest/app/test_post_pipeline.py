@@ -0,0 +1,163 @@
+# ***************************************************************************
+# *   Copyright (c) 2026 FreeCAD Project Association                        *
+# *                                                                         *
+# *   This file is part of the FreeCAD CAx development system.              *
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+__title__ = "Post pipeline FEM unit tests"
+__author__ = "FreeCAD Project Association"
+__url__ = "https://www.freecad.org"
+
+import unittest
+from os.path import join
+
+import FreeCAD
+
+import ObjectsFem
+
+from . import support_utils as testtools
+from .support_utils import fcc_print
+
+
+class ChangedDataObserver:
+    def __init__(self):
+        self.changed = []
+
+    def slotChangedObject(self, obj, prop):
+        if prop == "Data":
+            self.changed.append(obj.Name)
+
+
+@unittest.skipIf(
+    "BUILD_FEM_VTK" not in FreeCAD.__cmake__, "FEM post processing needs VTK"
+)
+class TestPostPipeline(unittest.TestCase):
+    fcc_print("import TestPostPipeline")
+
+    # ********************************************************************************************
+    def setUp(self):
+        # setUp is executed before every test
+
+        # new document
+        self.document = FreeCAD.newDocument(self.__class__.__name__)
+
+        # the result of the CalculiX box static analysis
+        from feminout import importCcxFrdResults
+
+        frd_file = join(testtools.get_fem_test_home_dir(), "calculix", "box_static.frd")
+        FreeCAD.setActiveDocument(self.document.Name)
+        importCcxFrdResults.importFrd(frd_file)
+        self.result = self.document.getObject("Results")
+
+    # ********************************************************************************************
+    def tearDown(self):
+        # tearDown is executed after every test
+        FreeCAD.closeDocument(self.document.Name)
+
+    # ********************************************************************************************
+    def test_00print(self):
+        # since method name starts with 00 this will be run first
+        # this test just prints a line with stars
+        fcc_print(
+            "\n{0}\n{1} run FEM TestPostPipeline tests {2}\n{0}".format(
+                100 * "*", 10 * "*", 56 * "*"
+            )
+        )
+
+    # ********************************************************************************************
+    def make_pipeline(self, name):
+        pipeline = ObjectsFem.makePostVtkResult(self.document, self.result, name)
+        pipeline.Mode = "Parallel"
+        return pipeline
+
+    def add_point_filter(self, pipeline, name, center):
+        point = self.document.addObject("Fem::FemPostDataAtPointFilter", name)
+        pipeline.Filter = pipeline.Filter + [point]
+        point.Center = center
+        point.FieldName = "von Mises Stress"
+        return point
+
+    # ********************************************************************************************
+    def test_lazy_recompute(self):
+        pipeline = self.make_pipeline("Lazy")
+        point = self.add_point_filter(pipeline, "LazyPoint", FreeCAD.Vector(5, 5, 5))
+        warp = ObjectsFem.makePostVtkFilterWarp(self.document, pipeline, "LazyWarp")
+        self.document.recompute()
+        values = point.PointData
+        self.assertEqual(len(values), 1)
+
+        observer = ChangedDataObserver()
+        FreeCAD.addDocumentObserver(observer)
+        try:
+            # both filters recompute, only the modified one regenerates its data
+            point.touch()
+            warp.Factor = 2.0
+            self.document.recompute()
+        finally:
+            FreeCAD.removeDocumentObserver(observer)
+
+        self.assertIn(warp.Name, observer.changed)
+        self.assertNotIn(point.Name, observer.changed)
+        self.assertEqual(point.PointData, values)
+
+    # ********************************************************************************************
+    def test_parallel_output(self):
+        centers = [FreeCAD.Vector(5, 5, 5), FreeCAD.Vector(2, 3, 4), FreeCAD.Vector(8, 1, 9)]
+
+        # the filters of one pipeline are updated concurrently
+        pipeline = self.make_pipeline("Concurrent")
+        points = []
+        for i, center in enumerate(centers):
+            points.append(self.add_point_filter(pipeline, "ConcurrentPoint%d" % i, center))
+        ObjectsFem.makePostVtkFilterWarp(self.document, pipeline, "ConcurrentWarp")
+        self.document.recompute()
+
+        # a pipeline with one filter each updates them on their own
+        for i, center in enumerate(centers):
+            reference = self.make_pipeline("Reference%d" % i)
+            self.add_point_filter(reference, "ReferencePoint%d" % i, center)
+        self.document.recompute()
+
+        for i, point in enumerate(points):
+            reference = self.document.getObject("ReferencePoint%d" % i)
+            self.assertEqual(len(point.PointData), 1)
+            self.assertEqual(point.PointData, reference.PointData)
+
+    # ********************************************************************************************
+    def test_large_input_sequential(self):
+        # inputs above the size limit are shared by filters updated one after another
+        param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Fem/General")
+        limit = param.GetUnsigned("ConcurrentFilterInputSize", 64)
+        param.SetUnsigned("ConcurrentFilterInputSize", 0)
+        try:
+            pipeline = self.make_pipeline("Sequential")
+            first = self.add_point_filter(pipeline, "SequentialPoint0", FreeCAD.Vector(5, 5, 5))
+            second = self.add_point_filter(pipeline, "SequentialPoint1", FreeCAD.Vector(2, 3, 4))
+            self.document.recompute()
+        finally:
+            param.SetUnsigned("ConcurrentFilterInputSize", limit)
+
+        reference = self.make_pipeline("Reference")
+        point = self.add_point_filter(reference, "ReferencePoint", FreeCAD.Vector(5, 5, 5))
+        self.document.recompute()
+
+        self.assertEqual(len(first.PointData), 1)
+        self.assertEqual(len(second.PointData), 1)
+        self.assertEqual(first.PointData, point.PointData)
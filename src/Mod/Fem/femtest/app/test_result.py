@@ -191,3 +191,57 @@ class TestResult(unittest.TestCase):
         self.assertEqual(
             disp_abs, expected_dispabs, "Calculated displacement abs are not the expected values."
         )
+
+    # ********************************************************************************************
+    def test_result_field_save_load(self):
+        res = self.document.addObject("Fem::FemResultObjectPython", "Result")
+        res.addProperty("Fem::PropertyResultField", "Displacement", "Fem")
+        res.addProperty("Fem::PropertyResultField", "Stress", "Fem")
+        res.Displacement = [
+            (1.0, [FreeCAD.Vector(1, 2, 3), FreeCAD.Vector(4, 5, 6)]),
+            (0.5, [FreeCAD.Vector(0.5, 1, 1.5), FreeCAD.Vector(2, 2.5, 3)]),
+        ]
+        res.Stress = [(0.0, [(1, 2, 3, 4, 5, 6), (6, 5, 4, 3, 2, 1)])]
+        # the steps are sorted by time
+        self.assertEqual([step[0] for step in res.Displacement], [0.5, 1.0])
+
+        file_path = join(testtools.get_fem_test_tmp_dir("result_field_save"), "result.FCStd")
+        self.document.saveAs(file_path)
+        FreeCAD.closeDocument(self.document.Name)
+        self.document = FreeCAD.openDocument(file_path)
+
+        res = self.document.getObject("Result")
+        self.assertEqual(
+            res.Displacement,
+            [
+                (0.5, [FreeCAD.Vector(0.5, 1, 1.5), FreeCAD.Vector(2, 2.5, 3)]),
+                (1.0, [FreeCAD.Vector(1, 2, 3), FreeCAD.Vector(4, 5, 6)]),
+            ],
+        )
+        self.assertEqual(res.Stress, [(0.0, [(1, 2, 3, 4, 5, 6), (6, 5, 4, 3, 2, 1)])])
+
+    # ********************************************************************************************
+    def test_read_frd_result(self):
+        import math
+        import Fem
+
+        frd_file = join(testtools.get_fem_test_home_dir(), "calculix", "box_static.frd")
+        m = Fem.readFrdResult(frd_file)
+        self.assertEqual(len(m["Nodes"]), 280)
+        self.assertEqual(len(m["Tetra10Elem"]), 129)
+        self.assertEqual(len(m["Hexa8Elem"]), 0)
+        # the node order of FemMesh, not the one of the frd file
+        self.assertEqual(m["Tetra10Elem"][1], (98, 95, 47, 196, 103, 198, 197, 199, 200, 201))
+        self.assertEqual(m["Nodes"][2], FreeCAD.Vector(0, 0, 10))
+
+        self.assertEqual(len(m["Results"]), 1)
+        result = m["Results"][0]
+        self.assertTrue(math.isnan(result["number"]))
+        self.assertEqual(result["time"], 1.0)
+        self.assertEqual(len(result["disp"]), 280)
+        self.assertEqual(result["disp"][1], FreeCAD.Vector(0, 0, 0))
+        # (Sxx, Syy, Szz, Sxy, Sxz, Syz)
+        self.assertEqual(
+            result["stress"][1], (-2620.33, -871.861, -800.594, -429.349, -542.662, -121.884)
+        )
+        self.assertEqual(len(result["strain"]), 280)
@@ -20,6 +20,7 @@ make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_material
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_mesh
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_object
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_open
+make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_post_pipeline
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_result
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_solver_calculix
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_solver_elmer
@@ -39,6 +40,7 @@ make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_mesh.TestMeshGroups
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_object.TestObjectCreate
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_object.TestObjectType
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_open.TestObjectOpen
+make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_post_pipeline.TestPostPipeline
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_result.TestResult
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_solver_calculix.TestSolverCalculix
 make -j 4 && ./bin/FreeCADCmd -t femtest.app.test_solver_elmer.TestSolverElmer
@@ -25,6 +25,9 @@
 #define WNT  // avoid conflict with GUID
 #endif
 #ifndef _PreComp_
+#include <exception>
+#include <memory>
+#include <unordered_set>
 #include <Interface_Static.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <Standard_Failure.hxx>
@@ -50,6 +53,7 @@
 #include <App/Link.h>
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
+#include <Base/Parallel.h>
 #include <Base/Parameter.h>
 #include <Mod/Part/App/FeatureCompound.h>
 #include <Mod/Part/App/Interface.h>
@@ -109,6 +113,7 @@ ImportOCAFOptions ImportOCAF2::customImportOptions()
     defaultOptions.showProgress = settings.getShowProgress();
     defaultOptions.expandCompound = settings.getExpandCompound();
     defaultOptions.mode = static_cast<int>(settings.getImportMode());
+    defaultOptions.parallel = settings.getParallelImport();
 
     auto hGrp =
         App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/View");
@@ -281,96 +286,273 @@ ImportOCAF2::expandShape(App::Document* doc, TDF_Label label, const TopoDS_Shape
     return info.obj;
 }
 
-bool ImportOCAF2::createObject(App::Document* doc,
-                               TDF_Label label,
-                               const TopoDS_Shape& shape,
-                               Info& info,
-                               bool newDoc)
+void ImportOCAF2::readObjectColors(TDF_Label label,
+                                   const TopoDS_Shape& shape,
+                                   ObjectColors& colors,
+                                   std::vector<SubShapeColor>& subColors)
 {
-    if (shape.IsNull() || !TopExp_Explorer(shape, TopAbs_VERTEX).More()) {
-        FC_WARN(Tools::labelName(label) << " has empty shape");
-        return false;
-    }
-
+    Info info;
     getColor(shape, info);
-    bool hasFaceColors = false;
-    bool hasEdgeColors = false;
-
-    Part::TopoShape tshape(shape);
-    std::vector<App::Color> faceColors;
-    std::vector<App::Color> edgeColors;
+    colors.faceColor = info.faceColor;
+    colors.edgeColor = info.edgeColor;
+    colors.hasFaceColor = info.hasFaceColor;
+    colors.hasEdgeColor = info.hasEdgeColor;
 
     TDF_LabelSequence seq;
-    if (!label.IsNull() && aShapeTool->GetSubShapes(label, seq)) {
-
-        TopTools_IndexedMapOfShape faceMap, edgeMap;
-        TopExp::MapShapes(tshape.getShape(), TopAbs_FACE, faceMap);
-        TopExp::MapShapes(tshape.getShape(), TopAbs_EDGE, edgeMap);
-
-        faceColors.assign(faceMap.Extent(), info.faceColor);
-        edgeColors.assign(edgeMap.Extent(), info.edgeColor);
-        // Two passes to get sub shape colors. First pass, look for solid, and
-        // second pass look for face and edges. This allows lower level
-        // subshape to override color of higher level ones.
-        for (int j = 0; j < 2; ++j) {
-            for (int i = 1; i <= seq.Length(); ++i) {
-                TDF_Label l = seq.Value(i);
-                TopoDS_Shape subShape = aShapeTool->GetShape(l);
-                if (subShape.IsNull()) {
+    if (label.IsNull() || !aShapeTool->GetSubShapes(label, seq)) {
+        return;
+    }
+    bool hasFaces = TopExp_Explorer(shape, TopAbs_FACE).More();
+    // Two passes to get sub shape colors. First pass, look for solid, and
+    // second pass look for face and edges. This allows lower level
+    // subshape to override color of higher level ones.
+    for (int j = 0; j < 2; ++j) {
+        for (int i = 1; i <= seq.Length(); ++i) {
+            TDF_Label l = seq.Value(i);
+            TopoDS_Shape subShape = aShapeTool->GetShape(l);
+            if (subShape.IsNull()) {
+                continue;
+            }
+            if (subShape.ShapeType() == TopAbs_FACE || subShape.ShapeType() == TopAbs_EDGE) {
+                if (j == 0) {
                     continue;
                 }
-                if (subShape.ShapeType() == TopAbs_FACE || subShape.ShapeType() == TopAbs_EDGE) {
-                    if (j == 0) {
-                        continue;
-                    }
-                }
-                else if (j != 0) {
-                    continue;
+            }
+            else if (j != 0) {
+                continue;
+            }
+
+            SubShapeColor subColor;
+            Quantity_ColorRGBA aColor;
+            if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
+                || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
+                subColor.faceColor = Tools::convertColor(aColor);
+                subColor.hasFaceColor = true;
+            }
+            if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
+                subColor.edgeColor = Tools::convertColor(aColor);
+                subColor.hasEdgeColor = true;
+                if (j == 0 && subColor.hasFaceColor && hasFaces
+                    && subColor.edgeColor == subColor.faceColor) {
+                    // Do not set edge the same color as face
+                    subColor.hasEdgeColor = false;
                 }
+            }
+            if (subColor.hasFaceColor || subColor.hasEdgeColor) {
+                subColor.shape = subShape;
+                subColors.push_back(std::move(subColor));
+            }
+        }
+    }
+}
+
+void ImportOCAF2::mapSubShapeColors(const TopoDS_Shape& shape,
+                                    const std::vector<SubShapeColor>& subColors,
+                                    ObjectColors& colors)
+{
+    if (subColors.empty()) {
+        return;
+    }
 
-                bool foundFaceColor = false, foundEdgeColor = false;
-                App::Color faceColor, edgeColor;
-                Quantity_ColorRGBA aColor;
-                if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
-                    || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
-                    faceColor = Tools::convertColor(aColor);
-                    foundFaceColor = true;
+    TopTools_IndexedMapOfShape faceMap, edgeMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+
+    auto& faceColors = colors.faceColors;
+    auto& edgeColors = colors.edgeColors;
+    faceColors.assign(faceMap.Extent(), colors.faceColor);
+    edgeColors.assign(edgeMap.Extent(), colors.edgeColor);
+    for (const auto& subColor : subColors) {
+        if (subColor.hasFaceColor) {
+            for (TopExp_Explorer exp(subColor.shape, TopAbs_FACE); exp.More(); exp.Next()) {
+                int idx = faceMap.FindIndex(exp.Current()) - 1;
+                if (idx >= 0 && idx < (int)faceColors.size()) {
+                    faceColors[idx] = subColor.faceColor;
+                    colors.hasFaceColors = true;
+                    colors.hasFaceColor = true;
                 }
-                if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
-                    edgeColor = Tools::convertColor(aColor);
-                    foundEdgeColor = true;
-                    if (j == 0 && foundFaceColor && !faceColors.empty() && edgeColor == faceColor) {
-                        // Do not set edge the same color as face
-                        foundEdgeColor = false;
-                    }
+                else {
+                    assert(0);
                 }
-
-                if (foundFaceColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_FACE); exp.More(); exp.Next()) {
-                        int idx = faceMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)faceColors.size()) {
-                            faceColors[idx] = faceColor;
-                            hasFaceColors = true;
-                            info.hasFaceColor = true;
-                        }
-                        else {
-                            assert(0);
-                        }
-                    }
+            }
+        }
+        if (subColor.hasEdgeColor) {
+            for (TopExp_Explorer exp(subColor.shape, TopAbs_EDGE); exp.More(); exp.Next()) {
+                int idx = edgeMap.FindIndex(exp.Current()) - 1;
+                if (idx >= 0 && idx < (int)edgeColors.size()) {
+                    edgeColors[idx] = subColor.edgeColor;
+                    colors.hasEdgeColors = true;
+                    colors.hasEdgeColor = true;
                 }
-                if (foundEdgeColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_EDGE); exp.More(); exp.Next()) {
-                        int idx = edgeMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)edgeColors.size()) {
-                            edgeColors[idx] = edgeColor;
-                            hasEdgeColors = true;
-                            info.hasEdgeColor = true;
-                        }
-                    }
+            }
+        }
+    }
+}
+
+void ImportOCAF2::getObjectColors(TDF_Label label, const TopoDS_Shape& shape, ObjectColors& colors)
+{
+    std::vector<SubShapeColor> subColors;
+    readObjectColors(label, shape, colors, subColors);
+    mapSubShapeColors(shape, subColors, colors);
+}
+
+bool ImportOCAF2::expandsShape(const TopoDS_Shape& shape) const
+{
+    Part::TopoShape tshape(shape);
+    return options.expandCompound
+        && (tshape.countSubShapes(TopAbs_SOLID) > 1
+            || (!tshape.countSubShapes(TopAbs_SOLID) && tshape.countSubShapes(TopAbs_SHELL) > 1));
+}
+
+void ImportOCAF2::prepareShapes()
+{
+    // Only the part (i.e. non assembly) shapes are prepared, together with the
+    // shapes of expanded compounds. XCAFDoc tools are not thread safe, so the
+    // colors are read from the OCAF document in this thread. Only mapping the
+    // sub shape colors to faces and edges runs in parallel. The App objects are
+    // still created in the calling thread in loadShape(), because
+    // App::Document is not thread safe.
+    myColors.clear();
+
+    struct PendingShape
+    {
+        TDF_Label label;
+        TopoDS_Shape shape;
+        bool expanding;
+    };
+    std::vector<PendingShape> pending;
+    TDF_LabelSequence labels;
+    aShapeTool->GetShapes(labels);
+    for (Standard_Integer i = 1; i <= labels.Length(); ++i) {
+        auto label = labels.Value(i);
+        if (!aShapeTool->IsAssembly(label)) {
+            auto shape = aShapeTool->GetShape(label).Located(TopLoc_Location());
+            pending.push_back({label, shape, false});
+        }
+    }
+
+    // Collect the shapes createObject() is called with. Those are keyed like
+    // in createObject(), i.e. the located sub shapes of an expanded compound.
+    std::vector<std::pair<TDF_Label, TopoDS_Shape>> shapes;
+    std::unordered_map<TopoDS_Shape, std::size_t, ShapeHasher> shapeIndex;
+    std::unordered_set<std::size_t> ambiguous;
+    while (!pending.empty()) {
+        auto [label, shape, expanding] = std::move(pending.back());
+        pending.pop_back();
+        if (shape.IsNull()) {
+            continue;
+        }
+        bool isCompound = shape.ShapeType() == TopAbs_COMPOUND;
+        if (!expanding || !isCompound) {
+            // reached through createObject()
+            auto inserted = shapeIndex.emplace(shape, shapes.size());
+            if (!inserted.second) {
+                // the colors depend on the label, leave a shape with several to createObject()
+                if (shapes[inserted.first->second].first != label) {
+                    ambiguous.insert(inserted.first->second);
                 }
+                continue;
+            }
+            shapes.emplace_back(label, shape);
+            if (!isCompound || !expandsShape(shape)) {
+                continue;
+            }
+        }
+        // reached through expandShape()
+        for (TopoDS_Iterator it(shape, Standard_False, Standard_False); it.More(); it.Next()) {
+            TDF_Label childLabel;
+            if (!label.IsNull()) {
+                aShapeTool->FindSubShape(label, it.Value(), childLabel);
             }
+            pending.push_back({childLabel, it.Value(), true});
         }
     }
+    if (shapes.size() < 2) {
+        return;
+    }
+
+    std::vector<ObjectColors> results(shapes.size());
+    std::vector<std::vector<SubShapeColor>> subColors(shapes.size());
+
+    // Run in batches so that the progress can be reported from this thread
+    const std::size_t batchSize = 4 * Base::parallelThreadCount();
+    const std::size_t batches = (shapes.size() + batchSize - 1) / batchSize;
+    std::unique_ptr<Base::SequencerLauncher> seq;
+    if (options.showProgress) {
+        seq = std::make_unique<Base::SequencerLauncher>("Preparing shapes...", batches);
+    }
+
+    FC_TIME_INIT(t);
+    std::vector<std::exception_ptr> errors(shapes.size());
+    for (std::size_t batch = 0; batch < batches; ++batch) {
+        const std::size_t begin = batch * batchSize;
+        const std::size_t end = std::min(begin + batchSize, shapes.size());
+        for (std::size_t i = begin; i < end; ++i) {
+            try {
+                readObjectColors(shapes[i].first, shapes[i].second, results[i], subColors[i]);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+        Base::parallelFor(end - begin, [&](std::size_t index) {
+            const std::size_t i = begin + index;
+            if (errors[i]) {
+                return;
+            }
+            try {
+                mapSubShapeColors(shapes[i].second, subColors[i], results[i]);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+            subColors[i].clear();
+        });
+        if (seq) {
+            seq->next(true);
+        }
+    }
+
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        if (errors[i] || ambiguous.count(i)) {
+            // fall back to the serial code path in createObject()
+            continue;
+        }
+        myColors.emplace(shapes[i].second, std::move(results[i]));
+    }
+    FC_TIME_LOG(t, "prepare " << shapes.size() << " shapes");
+}
+
+bool ImportOCAF2::createObject(App::Document* doc,
+                               TDF_Label label,
+                               const TopoDS_Shape& shape,
+                               Info& info,
+                               bool newDoc)
+{
+    if (shape.IsNull() || !TopExp_Explorer(shape, TopAbs_VERTEX).More()) {
+        FC_WARN(Tools::labelName(label) << " has empty shape");
+        return false;
+    }
+
+    ObjectColors colors;
+    auto it = myColors.find(shape);
+    if (it != myColors.end()) {
+        colors = std::move(it->second);
+        myColors.erase(it);
+    }
+    else {
+        getObjectColors(label, shape, colors);
+    }
+    info.faceColor = colors.faceColor;
+    info.edgeColor = colors.edgeColor;
+    info.hasFaceColor = colors.hasFaceColor;
+    info.hasEdgeColor = colors.hasEdgeColor;
+    const auto& faceColors = colors.faceColors;
+    const auto& edgeColors = colors.edgeColors;
+    bool hasFaceColors = colors.hasFaceColors;
+    bool hasEdgeColors = colors.hasEdgeColors;
+
+    Part::TopoShape tshape(shape);
 
     Part::Feature* feature;
 
@@ -378,9 +560,7 @@ bool ImportOCAF2::createObject(App::Document* doc,
         doc = getDocument(doc, label);
     }
 
-    if (options.expandCompound
-        && (tshape.countSubShapes(TopAbs_SOLID) > 1
-            || (!tshape.countSubShapes(TopAbs_SOLID) && tshape.countSubShapes(TopAbs_SHELL) > 1))) {
+    if (expandsShape(shape)) {
         feature = dynamic_cast<Part::Feature*>(expandShape(doc, label, shape));
         assert(feature);
     }
@@ -518,6 +698,10 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         Tools::dumpLabels(pDoc->Main(), aShapeTool, aColorTool);
     }
 
+    if (options.parallel) {
+        prepareShapes();
+    }
+
     TDF_LabelSequence labels;
     aShapeTool->GetShapes(labels);
     Base::SequencerLauncher seq("Importing...", labels.Length());
@@ -584,6 +768,7 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         ret->recomputeFeature(true);
     }
     sequencer = nullptr;
+    myColors.clear();
     return ret;
 }
 
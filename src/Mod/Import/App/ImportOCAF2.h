@@ -71,6 +71,7 @@ struct ImportExport ImportOCAFOptions
     bool reduceObjects = false;
     bool showProgress = false;
     bool expandCompound = false;
+    bool parallel = false;
     int mode = 0;
 };
 
@@ -108,6 +109,11 @@ public:
     {
         options.expandCompound = enable;
     }
+    /// Collect the colors of all part shapes in parallel before creating any object
+    void setParallel(bool enable)
+    {
+        options.parallel = enable;
+    }
 
     enum ImportMode
     {
@@ -137,6 +143,27 @@ private:
         int free = true;
     };
 
+    struct ObjectColors
+    {
+        App::Color faceColor;
+        App::Color edgeColor;
+        bool hasFaceColor = false;
+        bool hasEdgeColor = false;
+        std::vector<App::Color> faceColors;
+        std::vector<App::Color> edgeColors;
+        bool hasFaceColors = false;
+        bool hasEdgeColors = false;
+    };
+
+    struct SubShapeColor
+    {
+        TopoDS_Shape shape;
+        App::Color faceColor;
+        App::Color edgeColor;
+        bool hasFaceColor = false;
+        bool hasEdgeColor = false;
+    };
+
     App::DocumentObject* loadShape(App::Document* doc,
                                    TDF_Label label,
                                    const TopoDS_Shape& shape,
@@ -148,6 +175,18 @@ private:
                         const TopoDS_Shape& shape,
                         Info& info,
                         bool newDoc);
+    /// read the colors of a part shape and its sub shapes from the OCAF document
+    void readObjectColors(TDF_Label label,
+                          const TopoDS_Shape& shape,
+                          ObjectColors& colors,
+                          std::vector<SubShapeColor>& subColors);
+    /// map the sub shape colors to the faces and edges of the shape, without OCAF access
+    static void mapSubShapeColors(const TopoDS_Shape& shape,
+                                  const std::vector<SubShapeColor>& subColors,
+                                  ObjectColors& colors);
+    void getObjectColors(TDF_Label label, const TopoDS_Shape& shape, ObjectColors& colors);
+    bool expandsShape(const TopoDS_Shape& shape) const;
+    void prepareShapes();
     bool createObject(App::Document* doc,
                       TDF_Label label,
                       const TopoDS_Shape& shape,
@@ -208,6 +247,7 @@ private:
     std::unordered_map<TopoDS_Shape, Info, ShapeHasher> myShapes;
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
+    std::unordered_map<TopoDS_Shape, ObjectColors, ShapeHasher> myColors;
 
     Base::SequencerLauncher* sequencer {nullptr};
 };
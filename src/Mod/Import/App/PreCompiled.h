@@ -39,6 +39,8 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdio>
 #include <fcntl.h>
@@ -24,6 +24,8 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <tuple>
+#include <vector>
 #include <boost/core/ignore_unused.hpp>
 #include <Standard_Version.hxx>
 #if OCC_VERSION_HEX >= 0x070500
@@ -33,6 +35,7 @@
 #include <RWGltf_CafReader.hxx>
 #include <TDF_Label.hxx>
 #include <TDF_TagSource.hxx>
+#include <TopoDS_Compound.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_ColorTool.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
@@ -44,6 +47,7 @@
 #include "ReaderGltf.h"
 #include "Tools.h"
 #include <Base/Exception.h>
+#include <Base/Parallel.h>
 #include <Mod/Part/App/TopoShape.h>
 #include <Mod/Part/App/Tools.h>
 
@@ -79,11 +83,34 @@ void ReaderGltf::read(Handle(TDocStd_Document) hDoc)
 #endif
 }
 
+#if OCC_VERSION_HEX >= 0x070500
+namespace
+{
+struct LabelShape
+{
+    TDF_Label label;
+    TopoDS_Shape shape;
+    Quantity_ColorRGBA color;
+    bool hasColor {false};
+};
+}  // namespace
+#endif
+
 // NOLINTNEXTLINE
 void ReaderGltf::processDocument(Handle(TDocStd_Document) hDoc)
 {
 #if OCC_VERSION_HEX >= 0x070500
     Handle(XCAFDoc_ShapeTool) aShapeTool = XCAFDoc_DocumentTool::ShapeTool(hDoc->Main());
+    Handle(XCAFDoc_ColorTool) aColorTool = XCAFDoc_DocumentTool::ColorTool(hDoc->Main());
+    Handle(XCAFDoc_VisMaterialTool) aVisTool = XCAFDoc_DocumentTool::VisMaterialTool(hDoc->Main());
+
+    // A mesh that is referenced by several glTF nodes is a single part label, which is
+    // fixed once and imported as linked instances. Fixing the shapes dominates the import time,
+    // so the shapes are collected first, fixed concurrently and then put back into the
+    // document, which must only be modified by one thread.
+    std::vector<LabelShape> shapes;
+    // the labels of the compounds and the ranges of their sub-shapes in shapes
+    std::vector<std::tuple<TDF_Label, std::size_t, std::size_t>> compounds;
 
     TDF_LabelSequence shapeLabels;
     aShapeTool->GetShapes(shapeLabels);
@@ -93,60 +120,52 @@ void ReaderGltf::processDocument(Handle(TDocStd_Document) hDoc)
         if (!shape.IsNull()) {
             TDF_LabelSequence subShapeLabels;
             if (XCAFDoc_ShapeTool::GetSubShapes(topLevelshape, subShapeLabels)) {
-                TopoDS_Shape compound = processSubShapes(hDoc, subShapeLabels);
-                aShapeTool->SetShape(topLevelshape, compound);
+                std::size_t first = shapes.size();
+                for (Standard_Integer j = 1; j <= subShapeLabels.Length(); j++) {
+                    auto faceLabel = subShapeLabels.Value(j);
+                    LabelShape face {faceLabel, aShapeTool->GetShape(faceLabel)};
+
+                    // OCCT handles colors of a glTF with material labels but the ImportOCAF(2)
+                    // class expects color labels. Thus, the material labels are converted into
+                    // color labels.
+                    Handle(XCAFDoc_VisMaterial) aVisMat = aVisTool->GetShapeMaterial(faceLabel);
+                    if (!aVisMat.IsNull()) {
+                        face.color = aVisMat->BaseColor();
+                        face.hasColor = true;
+                    }
+                    shapes.push_back(face);
+                }
+                compounds.emplace_back(topLevelshape, first, shapes.size());
             }
             else {
-                aShapeTool->SetShape(topLevelshape, fixShape(shape));
+                shapes.push_back(LabelShape {topLevelshape, shape});
             }
         }
     }
-#else
-    boost::ignore_unused(hDoc);
-#endif
-}
 
-// NOLINTNEXTLINE
-TopoDS_Shape ReaderGltf::processSubShapes(Handle(TDocStd_Document) hDoc,
-                                          const TDF_LabelSequence& subShapeLabels)
-{
-    TopoDS_Compound compound;
-#if OCC_VERSION_HEX >= 0x070500
-    Handle(XCAFDoc_ShapeTool) aShapeTool = XCAFDoc_DocumentTool::ShapeTool(hDoc->Main());
-    Handle(XCAFDoc_ColorTool) aColorTool = XCAFDoc_DocumentTool::ColorTool(hDoc->Main());
-    Handle(XCAFDoc_VisMaterialTool) aVisTool = XCAFDoc_DocumentTool::VisMaterialTool(hDoc->Main());
+    Base::parallelFor(shapes.size(), [&](std::size_t index) {
+        shapes[index].shape = fixShape(shapes[index].shape);
+    });
 
-    BRep_Builder builder;
-    builder.MakeCompound(compound);
-    for (Standard_Integer i = 1; i <= subShapeLabels.Length(); i++) {
-        auto faceLabel = subShapeLabels.Value(i);
-
-        // OCCT handles colors of a glTF with material labels but the ImportOCAF(2) class
-        // expects color labels. Thus, the material labels are converted into color labels.
-        Handle(XCAFDoc_VisMaterial) aVisMat = aVisTool->GetShapeMaterial(faceLabel);
-
-        Quantity_ColorRGBA rgba;
-        bool hasVisMat {false};
-        if (!aVisMat.IsNull()) {
-            rgba = aVisMat->BaseColor();
-            hasVisMat = true;
+    for (const auto& it : shapes) {
+        aShapeTool->SetShape(it.label, it.shape);
+        if (it.hasColor) {
+            aColorTool->SetColor(it.label, it.color, XCAFDoc_ColorSurf);
         }
+    }
 
-        TopoDS_Shape face = aShapeTool->GetShape(faceLabel);
-        TopoDS_Shape fixed = fixShape(face);
-        builder.Add(compound, fixed);
-        aShapeTool->SetShape(faceLabel, fixed);
-
-        if (hasVisMat) {
-            aColorTool->SetColor(faceLabel, rgba, XCAFDoc_ColorSurf);
+    for (const auto& [label, first, last] : compounds) {
+        BRep_Builder builder;
+        TopoDS_Compound compound;
+        builder.MakeCompound(compound);
+        for (std::size_t i = first; i < last; i++) {
+            builder.Add(compound, shapes[i].shape);
         }
+        aShapeTool->SetShape(label, compound);
     }
 #else
     boost::ignore_unused(hDoc);
-    boost::ignore_unused(subShapeLabels);
 #endif
-
-    return {std::move(compound)};
 }
 
 bool ReaderGltf::cleanup() const
@@ -24,17 +24,34 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <vector>
 #include <boost/core/ignore_unused.hpp>
 #include <Standard_Version.hxx>
 #include <TColStd_IndexedDataMapOfStringString.hxx>
 #if OCC_VERSION_HEX >= 0x070500
+#include <BRepBndLib.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <IMeshTools_Parameters.hxx>
 #include <Message_ProgressRange.hxx>
 #include <RWGltf_CafWriter.hxx>
+#include <TDF_LabelSequence.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
 #endif
 #endif
 
 #include "WriterGltf.h"
+#include <App/Application.h>
 #include <Base/Exception.h>
+#include <Base/Parallel.h>
+#include <Base/Parameter.h>
+#include <Base/Tools.h>
 #include <Mod/Part/App/encodeFilename.h>
 
 using namespace Import;
@@ -58,6 +75,7 @@ void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
 #if OCC_VERSION_HEX >= 0x070700
     aWriter.SetParallel(true);
 #endif
+    triangulate(hDoc);
     Standard_Boolean ret = aWriter.Perform(hDoc, aMetadata, Message_ProgressRange());
     if (!ret) {
         throw Base::FileException("Cannot save to file: ", file);
@@ -67,3 +85,122 @@ void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
     throw Base::RuntimeError("gITF support requires OCCT 7.5.0 or later");
 #endif
 }
+
+#if OCC_VERSION_HEX >= 0x070500
+namespace
+{
+bool hasTriangulation(const TopoDS_Shape& shape)
+{
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        if (BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull()) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+#endif
+
+void WriterGltf::triangulate(Handle(TDocStd_Document) hDoc) const  // NOLINT
+{
+#if OCC_VERSION_HEX >= 0x070500
+    // Only meshes are written, so parts that have never been displayed must be triangulated.
+    // Repeated occurrences of a part reference the same label and the writer shares its mesh
+    // between them, hence every distinct part shape is meshed once.
+    Handle(XCAFDoc_ShapeTool) aShapeTool = XCAFDoc_DocumentTool::ShapeTool(hDoc->Main());
+    TDF_LabelSequence labels;
+    aShapeTool->GetShapes(labels);
+
+    std::vector<TopoDS_Shape> parts;
+    TopTools_MapOfShape distinct;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        if (XCAFDoc_ShapeTool::IsAssembly(labels.Value(i))) {
+            continue;
+        }
+        TopoDS_Shape shape = XCAFDoc_ShapeTool::GetShape(labels.Value(i));
+        if (shape.IsNull()) {
+            continue;
+        }
+        shape.Location(TopLoc_Location());
+        if (distinct.Add(shape) && !hasTriangulation(shape)) {
+            parts.push_back(shape);
+        }
+    }
+    if (parts.empty()) {
+        return;
+    }
+
+    // Meshing a part writes to its edges, so parts sharing edges must not be meshed at the
+    // same time
+    std::vector<int> independent;
+    std::vector<int> shared;
+    {
+        std::vector<bool> isShared(parts.size(), false);
+        TopTools_DataMapOfShapeInteger owners;
+        for (std::size_t i = 0; i < parts.size(); i++) {
+            for (TopExp_Explorer xp(parts[i], TopAbs_EDGE); xp.More(); xp.Next()) {
+                TopoDS_Shape edge = xp.Current().Located(TopLoc_Location());
+                auto index = static_cast<Standard_Integer>(i);
+                if (owners.IsBound(edge)) {
+                    if (owners.Find(edge) != index) {
+                        isShared[owners.Find(edge)] = true;
+                        isShared[i] = true;
+                    }
+                }
+                else {
+                    owners.Bind(edge, index);
+                }
+            }
+        }
+        for (std::size_t i = 0; i < parts.size(); i++) {
+            (isShared[i] ? shared : independent).push_back(static_cast<int>(i));
+        }
+    }
+
+    // Use the same parameters as the 3D view so that displayed and exported parts look alike
+    ParameterGrp::handle hGrp =
+        App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part");
+    double deviation = hGrp->GetFloat("MeshDeviation", 0.2);                 // NOLINT
+    double angularDeflection = hGrp->GetFloat("MeshAngularDeflection", 28.65);  // NOLINT
+
+    auto mesh = [&](const TopoDS_Shape& shape, bool parallel) {
+        Bnd_Box bounds;
+        BRepBndLib::Add(shape, bounds);
+        if (bounds.IsVoid()) {
+            return;
+        }
+        bounds.SetGap(0.0);
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;  // NOLINT
+        bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        // NOLINTNEXTLINE
+        double deflection = ((xMax - xMin) + (yMax - yMin) + (zMax - zMin)) / 300.0 * deviation;
+        if (deflection < gp::Resolution()) {
+            deflection = Precision::Confusion();
+        }
+
+        IMeshTools_Parameters meshParams;
+        meshParams.Deflection = deflection;
+        meshParams.Relative = Standard_False;
+        meshParams.Angle = Base::toRadians(angularDeflection);
+        meshParams.InParallel = parallel;
+        meshParams.AllowQualityDecrease = Standard_True;
+        BRepMesh_IncrementalMesh(shape, meshParams);
+    };
+
+    // With several parts every part is meshed by its own worker, a single part uses the
+    // parallel mode of the mesher instead
+    bool single = independent.size() < 2;
+    Base::parallelFor(
+        independent.size(),
+        [&](std::size_t index) {
+            mesh(parts[independent[index]], single);
+        },
+        single ? 1 : Base::parallelThreadCount());
+    for (int index : shared) {
+        mesh(parts[index], true);
+    }
+#else
+    boost::ignore_unused(hDoc);
+#endif
+}
@@ -39,6 +39,8 @@ public:
     void write(Handle(TDocStd_Document) hDoc) const;
 
 private:
+    void triangulate(Handle(TDocStd_Document) hDoc) const;
+
     Base::FileInfo file;
 };
 }  // namespace Import
@@ -23,6 +23,8 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
 #include <Standard_Version.hxx>
 #if OCC_VERSION_HEX < 0x070600
 #include <BRepAdaptor_HCurve.hxx>
@@ -39,6 +41,7 @@
 #include <Geom_BSplineCurve.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Edge.hxx>
@@ -61,6 +64,7 @@
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 #include <Base/Matrix.h>
+#include <Base/Parallel.h>
 #include <Base/Parameter.h>
 #include <Base/Vector3D.h>
 #include <Base/PlacementPy.h>
@@ -97,6 +101,7 @@ bool ImpExpDxfRead::ReadEntitiesSection()
             if (!CDxfRead::ReadEntitiesSection()) {
                 return false;
             }
+            savingCollector.BuildShapes();
         }
 
         // Merge the contents of ShapesToCombine and AddObject the result(s)
@@ -137,6 +142,27 @@ void ImpExpDxfRead::CombineShapes(std::list<TopoDS_Shape>& shapes, const char* n
     }
 }
 
+void ImpExpDxfRead::ShapeSavingEntityCollector::BuildShapes()
+{
+    // Making the OCC shapes dominates the import of large drawings, so ranges of the pending
+    // shapes are built in parallel.
+    std::atomic<int> failures {0};
+    Base::parallelForRanges(PendingShapes.size(), 1024, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            try {
+                *PendingShapes[i].first = PendingShapes[i].second();
+            }
+            catch (const Standard_Failure&) {
+                failures++;
+            }
+        }
+    });
+    PendingShapes.clear();
+    if (failures > 0) {
+        Base::Console().Warning("ImpExpDxf - failed to create %d shapes\n", failures.load());
+    }
+}
+
 void ImpExpDxfRead::setOptions()
 {
     ParameterGrp::handle hGrp =
@@ -213,13 +239,22 @@ void ImpExpDxfRead::OnReadLine(const Base::Vector3d& start,
         // TODO: Really?? What about the people designing integrated circuits?
         return;
     }
-    Collector->AddObject(BRepBuilderAPI_MakeEdge(p0, p1).Edge(), "Line");
+    Collector->AddObject(
+        [p0, p1]() -> TopoDS_Shape {
+            return BRepBuilderAPI_MakeEdge(p0, p1).Edge();
+        },
+        "Line");
 }
 
 
 void ImpExpDxfRead::OnReadPoint(const Base::Vector3d& start)
 {
-    Collector->AddObject(BRepBuilderAPI_MakeVertex(makePoint(start)).Vertex(), "Point");
+    gp_Pnt p0 = makePoint(start);
+    Collector->AddObject(
+        [p0]() -> TopoDS_Shape {
+            return BRepBuilderAPI_MakeVertex(p0).Vertex();
+        },
+        "Point");
 }
 
 
@@ -238,7 +273,11 @@ void ImpExpDxfRead::OnReadArc(const Base::Vector3d& start,
     gp_Pnt pc = makePoint(center);
     gp_Circ circle(gp_Ax2(pc, up), p0.Distance(pc));
     if (circle.Radius() > 0) {
-        Collector->AddObject(BRepBuilderAPI_MakeEdge(circle, p0, p1).Edge(), "Arc");
+        Collector->AddObject(
+            [circle, p0, p1]() -> TopoDS_Shape {
+                return BRepBuilderAPI_MakeEdge(circle, p0, p1).Edge();
+            },
+            "Arc");
     }
     else {
         Base::Console().Warning("ImpExpDxf - ignore degenerate arc of circle\n");
@@ -259,7 +298,11 @@ void ImpExpDxfRead::OnReadCircle(const Base::Vector3d& start,
     gp_Pnt pc = makePoint(center);
     gp_Circ circle(gp_Ax2(pc, up), p0.Distance(pc));
     if (circle.Radius() > 0) {
-        Collector->AddObject(BRepBuilderAPI_MakeEdge(circle).Edge(), "Circle");
+        Collector->AddObject(
+            [circle]() -> TopoDS_Shape {
+                return BRepBuilderAPI_MakeEdge(circle).Edge();
+            },
+            "Circle");
     }
     else {
         Base::Console().Warning("ImpExpDxf - ignore degenerate circle\n");
@@ -401,7 +444,11 @@ void ImpExpDxfRead::OnReadEllipse(const Base::Vector3d& center,
     gp_Elips ellipse(gp_Ax2(pc, up), major_radius, minor_radius);
     ellipse.Rotate(gp_Ax1(pc, up), rotation);
     if (ellipse.MinorRadius() > 0) {
-        Collector->AddObject(BRepBuilderAPI_MakeEdge(ellipse).Edge(), "Ellipse");
+        Collector->AddObject(
+            [ellipse]() -> TopoDS_Shape {
+                return BRepBuilderAPI_MakeEdge(ellipse).Edge();
+            },
+            "Ellipse");
     }
     else {
         Base::Console().Warning("ImpExpDxf - ignore degenerate ellipse\n");
@@ -474,6 +521,15 @@ void ImpExpDxfRead::ExpandInsert(const std::string& name,
     localTransform.rotZ(rotation);
     localTransform.move(point[0], point[1], point[2]);
     localTransform = transform * localTransform;
+    gp_Trsf trsf = Part::TopoShape::convert(localTransform);
+    // A rigid transform places the block shapes as instances sharing their geometry, only a
+    // scaled insertion needs copies.
+    bool instance = trsf.ScaleFactor() > 0.0
+        && std::abs(trsf.ScaleFactor() - 1.0) < Precision::Confusion();
+    if (instance) {
+        // TopoDS_Shape::Moved() rejects any scale off by more than TopLoc_Location::ScalePrec()
+        trsf.SetScaleFactor(1.0);
+    }
     CommonEntityAttributes mainAttributes = m_entityAttributes;
     for (const auto& [attributes, shapes] : block.Shapes) {
         // Put attributes into m_entityAttributes after using the latter to set byblock values in
@@ -484,12 +540,14 @@ void ImpExpDxfRead::ExpandInsert(const std::string& name,
         for (const TopoDS_Shape& shape : shapes) {
             // TODO???: See the comment in TopoShape::makeTransform regarding calling
             // Moved(identityTransform) on the new shape
-            Collector->AddObject(
-                BRepBuilderAPI_Transform(shape,
-                                         Part::TopoShape::convert(localTransform),
-                                         Standard_True)
-                    .Shape(),
-                "InsertPart");  // TODO: The collection should contain the nameBase to use
+            // TODO: The collection should contain the nameBase to use
+            if (instance) {
+                Collector->AddObject(shape.Moved(TopLoc_Location(trsf)), "InsertPart");
+            }
+            else {
+                Collector->AddObject(BRepBuilderAPI_Transform(shape, trsf, Standard_True).Shape(),
+                                     "InsertPart");
+            }
         }
     }
     for (const auto& [attributes, featureBuilders] : block.FeatureBuildersList) {
@@ -592,6 +650,7 @@ void ImpExpDxfRead::OnReadPolyline(std::list<VertexInfo>& vertices, int flags)
         // because they are constant throughout.
         ShapeSavingEntityCollector savingCollector(*this, ShapesToCombine);
         ExplodePolyline(vertices, flags);
+        savingCollector.BuildShapes();
     }
     // Join the shapes.
     if (!ShapesToCombine.empty()) {
@@ -155,6 +155,8 @@ protected:
 
     using FeaturePythonBuilder =
         std::function<App::FeaturePython*(const Base::Matrix4D& transform)>;
+    // Builders of shapes only use the values they captured, so they can run on any thread
+    using ShapeBuilder = std::function<TopoDS_Shape()>;
     // Block management
     class Block
     {
@@ -227,6 +229,16 @@ protected:
 
         // Called by OnReadXxxx functions to add Part objects
         virtual void AddObject(const TopoDS_Shape& shape, const char* nameBase) = 0;
+        // Called by OnReadXxxx functions to add Part objects whose shape is made by a builder.
+        // Collectors which only gather shapes may defer the builder and run it concurrently with
+        // others.
+        virtual void AddObject(const ShapeBuilder& shapeBuilder, const char* nameBase)
+        {
+            TopoDS_Shape shape = shapeBuilder();
+            if (!shape.IsNull()) {
+                AddObject(shape, nameBase);
+            }
+        }
         // Called by OnReadXxxx functions to add FeaturePython (draft) objects.
         // Because we can't readily copy Draft objects, this method instead takes a builder which,
         // when called, creates and returns the object.
@@ -277,9 +289,19 @@ protected:
         {
             ShapesList[Reader.m_entityAttributes].push_back(shape);
         }
+        void AddObject(const ShapeBuilder& shapeBuilder, const char* /*nameBase*/) override
+        {
+            // Reserve the place of the shape in its list, BuildShapes fills it in.
+            std::list<TopoDS_Shape>& shapes = ShapesList[Reader.m_entityAttributes];
+            shapes.emplace_back();
+            PendingShapes.emplace_back(&shapes.back(), shapeBuilder);
+        }
+        // Run the deferred builders concurrently. This must be called before the shapes are used.
+        void BuildShapes();
 
     private:
         std::map<CDxfRead::CommonEntityAttributes, std::list<TopoDS_Shape>>& ShapesList;
+        std::vector<std::pair<TopoDS_Shape*, ShapeBuilder>> PendingShapes;
     };
 #ifdef LATER
     class PolylineEntityCollector: public CombiningDrawingEntityCollector
@@ -7,11 +7,16 @@
 
 // required by windows for M_PI definition
 #define _USE_MATH_DEFINES
+#include <cctype>
+#include <charconv>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <type_traits>
 
 #include "dxf.h"
 #include <App/Application.h>
@@ -32,6 +37,33 @@ static Base::Vector3d MakeVector3d(const double coordinates[3])
     return Base::Vector3d(coordinates[0], coordinates[1], coordinates[2]);
 }
 
+// Parses the number at the start of [first, last) like operator>> of a stream in the "C" locale,
+// skipping leading white space and ignoring anything after the number.
+template<typename T>
+static bool ParseNumber(const char* first, const char* last, T& value)
+{
+    while (first < last && std::isspace(static_cast<unsigned char>(*first))) {
+        ++first;
+    }
+    // from_chars doesn't accept a plus sign
+    if (first < last && *first == '+') {
+        ++first;
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+#if defined(__cpp_lib_to_chars)
+        return std::from_chars(first, last, value).ec == std::errc();
+#else
+        std::string text(first, last);
+        char* end = nullptr;
+        value = std::strtod(text.c_str(), &end);
+        return end != text.c_str();
+#endif
+    }
+    else {
+        return std::from_chars(first, last, value).ec == std::errc();
+    }
+}
+
 CDxfWrite::CDxfWrite(const char* filepath)
     :  // TODO: these should probably be parameters in config file
        // handles:
@@ -1800,19 +1832,32 @@ void CDxfWrite::writeObjectsSection()
 const DxfUnits DxfUnits::Instance;
 
 CDxfRead::CDxfRead(const std::string& filepath)
-    : m_ifs(new ifstream(filepath))
 {
-    if (!(*m_ifs)) {
+    // Reading the file at once avoids the per-line overhead of the stream, which dominates the
+    // import time of large files.
+    ifstream ifs(filepath, ios::in | ios::binary);
+    if (ifs) {
+        ifs.seekg(0, ios::end);
+        std::streamoff size = ifs.tellg();
+        ifs.seekg(0, ios::beg);
+        if (size >= 0) {
+            m_buffer.resize(static_cast<std::size_t>(size));
+            ifs.read(m_buffer.data(), size);
+        }
+    }
+    if (!ifs) {
         m_fail = true;
         ImportError("DXF file didn't load\n");
         return;
     }
-    m_ifs->imbue(std::locale("C"));
+    // Skip a UTF-8 byte order mark
+    if (m_buffer.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+        m_position = 3;
+    }
 }
 
 CDxfRead::~CDxfRead()
 {
-    delete m_ifs;
     // Delete the Layer objects which are referenced by pointer from the Layers table.
     for (auto& pair : Layers) {
         delete pair.second;
@@ -1870,13 +1915,9 @@ void CDxfRead::SetupValueAttribute(eDXFGroupCode_t record_type, T& destination)
 // Static processing helpers for ProcessCommonEntityAttribute
 void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
+    const std::string& data = object->m_record_data;
     double value = 0;
-    ss >> value;
-    if (ss.fail()) {
+    if (!ParseNumber(data.data(), data.data() + data.size(), value)) {
         object->ImportError("Unable to parse value '%s', using zero as its value\n",
                             object->m_record_data);
     }
@@ -1884,13 +1925,9 @@ void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
 }
 void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
+    const std::string& data = object->m_record_data;
     double value = 0;
-    ss >> value;
-    if (ss.fail()) {
+    if (!ParseNumber(data.data(), data.data() + data.size(), value)) {
         object->ImportError("Unable to parse value '%s', using zero as its value\n",
                             object->m_record_data);
     }
@@ -1899,18 +1936,25 @@ void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 template<typename T>
 bool CDxfRead::ParseValue(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
-    ss >> *static_cast<T*>(target);
-    if (ss.fail()) {
+    const std::string& data = object->m_record_data;
+    bool parsed = false;
+    if constexpr (std::is_same_v<T, bool>) {
+        // Like a stream without boolalpha, only 0 and 1 are accepted
+        int value = 0;
+        parsed = ParseNumber(data.data(), data.data() + data.size(), value)
+            && (value == 0 || value == 1);
+        *static_cast<bool*>(target) = value != 0;
+    }
+    else {
+        parsed = ParseNumber(data.data(), data.data() + data.size(), *static_cast<T*>(target));
+    }
+    if (!parsed) {
         object->ImportError("Unable to parse value '%s', using zero as its value\n",
                             object->m_record_data);
         *static_cast<T*>(target) = 0;
         return false;
     }
-    // TODO: Verify nothing it left but whitespace in ss.
+    // TODO: Verify nothing it left but whitespace in the record.
     return true;
 }
 void CDxfRead::ProcessStdString(CDxfRead* object, void* target)
@@ -2350,6 +2394,28 @@ void CDxfRead::UnsupportedFeature(const char* format, args&&... argValuess)
     }
 }
 
+bool CDxfRead::get_next_line(const char*& first, const char*& last)
+{
+    if (m_position >= m_buffer.size()) {
+        return false;
+    }
+    const char* end = m_buffer.data() + m_buffer.size();
+    first = m_buffer.data() + m_position;
+    last = static_cast<const char*>(std::memchr(first, '\n', end - first));
+    if (last == nullptr) {
+        last = end;
+    }
+    m_position = last - m_buffer.data() + 1;
+    ++m_line;
+
+    // Remove any carriage return at the end of the line which may occur because of inconsistent
+    // handling of LF vs. CRLF line termination.
+    if (last > first && *(last - 1) == '\r') {
+        --last;
+    }
+    return true;
+}
+
 bool CDxfRead::get_next_record()
 {
     if (m_repeat_last_record) {
@@ -2358,34 +2424,29 @@ bool CDxfRead::get_next_record()
     }
 
     do {
-        if ((*m_ifs).eof()) {
+        const char* first = nullptr;
+        const char* last = nullptr;
+        if (!get_next_line(first, last)) {
             m_not_eof = false;
             return false;
         }
 
-        std::getline(*m_ifs, m_record_data);
-        ++m_line;
         int temp = 0;
-        if (!ParseValue<int>(this, &temp)) {
+        if (!ParseNumber(first, last, temp)) {
+            m_record_data.assign(first, last);
             ImportError("CDxfRead::get_next_record() Failed to get integer record type from '%s'\n",
                         m_record_data);
             return false;
         }
         m_record_type = (eDXFGroupCode_t)temp;
-        if ((*m_ifs).eof()) {
+        if (!get_next_line(first, last)) {
+            m_not_eof = false;
             return false;
         }
 
-        std::getline(*m_ifs, m_record_data);
-        ++m_line;
+        m_record_data.assign(first, last);
     } while (m_record_type == eComment);
 
-    // Remove any carriage return at the end of m_str which may occur because of inconsistent
-    // handling of LF vs. CRLF line termination.
-    auto last = m_record_data.rbegin();
-    if (last != m_record_data.rend() && *last == '\r') {
-        m_record_data.pop_back();
-    }
     // The code that was here just blindly trimmed leading white space, but if you have, for
     // instance, a TEXT entity whose text starts with spaces, or, more plausibly, a long TEXT entity
     // where the text is broken into one or more type-3 records with a final type-1 and the break
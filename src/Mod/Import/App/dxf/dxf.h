@@ -440,7 +440,9 @@ class ImportExport CDxfRead
 {
 private:
     // Low-level reader members
-    std::ifstream* m_ifs;  // TODO: gsl::owner<ifstream>
+    // The whole file is read at once, and the records are taken from memory
+    std::string m_buffer;
+    std::size_t m_position = 0;  // start of the next line in m_buffer
     // https://stackoverflow.com/questions/41167119/how-to-fix-a-wsubobject-linkage-warning
     eDXFGroupCode_t m_record_type = eObjectType;
     std::string m_record_data;
@@ -664,6 +666,7 @@ private:
     bool ReadBlockInfo();
     bool ResolveEncoding();
 
+    bool get_next_line(const char*& first, const char*& last);
     bool get_next_record();
     void repeat_last_record();
 
@@ -34,3 +34,5 @@ FreeCAD.addImportType("STEPZ Zip File Type (*.stpZ *.stpz *.STPZ)", "stepZ")
 FreeCAD.addImportType("glTF (*.gltf *.GLTF *.glb *.GLB)", "ImportGui")
 FreeCAD.addExportType("STEPZ zip File Type (*.stpZ *.stpz)", "stepZ")
 FreeCAD.addExportType("glTF (*.gltf *.glb)", "ImportGui")
+
+FreeCAD.__unit_test__ += ["TestImportApp"]
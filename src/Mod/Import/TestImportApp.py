@@ -0,0 +1,155 @@
+# **************************************************************************
+#   Copyright (c) 2026 FreeCAD Project Association                        *
+#                                                                         *
+#   This file is part of FreeCAD.                                         *
+#                                                                         *
+#   FreeCAD is free software: you can redistribute it and/or modify it    *
+#   under the terms of the GNU Lesser General Public License as           *
+#   published by the Free Software Foundation, either version 2.1 of the  *
+#   License, or (at your option) any later version.                       *
+#                                                                         *
+#   FreeCAD is distributed in the hope that it will be useful, but        *
+#   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+#   Lesser General Public License for more details.                       *
+#                                                                         *
+#   You should have received a copy of the GNU Lesser General Public      *
+#   License along with FreeCAD. If not, see                               *
+#   <https://www.gnu.org/licenses/>.                                      *
+#                                                                         *
+# **************************************************************************
+
+import json
+import os
+import struct
+import tempfile
+import unittest
+import FreeCAD as App
+import Import
+import Part
+
+
+def readGlbJson(fileName):
+    """Return the JSON chunk of a binary glTF file"""
+    with open(fileName, "rb") as f:
+        magic, version, length = struct.unpack("<4sII", f.read(12))
+        if magic != b"glTF":
+            raise ValueError("not a binary glTF file")
+        chunkLength, chunkType = struct.unpack("<I4s", f.read(8))
+        if chunkType != b"JSON":
+            raise ValueError("missing JSON chunk")
+        return json.loads(f.read(chunkLength))
+
+
+class GltfLinkTest(unittest.TestCase):
+    def setUp(self):
+        self.fileName = os.path.join(tempfile.gettempdir(), "GltfLinkTest.glb")
+        self.doc = App.newDocument()
+
+    def tearDown(self):
+        App.closeDocument(self.doc.Name)
+        if os.path.exists(self.fileName):
+            os.remove(self.fileName)
+
+    def testExportImportLinks(self):
+        """
+        Two links to one part are written as one mesh and imported as links again
+        """
+        box = self.doc.addObject("Part::Box", "Box")
+        links = []
+        for x in (0, 20):
+            link = self.doc.addObject("App::Link", "Link")
+            link.LinkedObject = box
+            link.Placement.Base = App.Vector(x, 0, 0)
+            links.append(link)
+        self.doc.recompute()
+
+        Import.export(links, self.fileName)
+
+        gltf = readGlbJson(self.fileName)
+        self.assertEqual(len(gltf["meshes"]), 1)
+        meshNodes = [node for node in gltf["nodes"] if "mesh" in node]
+        self.assertEqual(len(meshNodes), 2)
+
+        self.doc.clearDocument()
+        Import.insert(self.fileName, self.doc.Name, merge=False, useLinkGroup=True)
+        self.doc.recompute()
+
+        parts = [obj for obj in self.doc.Objects if obj.isDerivedFrom("Part::Feature")]
+        self.assertEqual(len(parts), 1)
+        self.assertGreater(len(parts[0].Shape.Faces), 0)
+        imported = [obj for obj in self.doc.Objects if obj.isDerivedFrom("App::Link")]
+        self.assertGreater(len(imported), 0)
+        for link in imported:
+            self.assertEqual(link.getLinkedObject(), parts[0])
+
+        # the visible objects still place the part twice
+        roots = [obj for obj in self.doc.Objects if not obj.InList and obj.Visibility]
+        shape = Part.makeCompound([Part.getShape(obj) for obj in roots])
+        self.assertEqual(len(shape.Solids), 2)
+        self.assertAlmostEqual(shape.BoundBox.XLength, 30.0, places=3)
+
+
+class ParallelImportTest(unittest.TestCase):
+    def setUp(self):
+        self.fileName = os.path.join(tempfile.gettempdir(), "ParallelImportTest.step")
+        self.doc = App.newDocument()
+        self.param = App.ParamGet("User parameter:BaseApp/Preferences/Mod/Import")
+        self.saved = {
+            key: self.param.GetBool(key) if key in self.param.GetBools() else None
+            for key in ("ParallelImport", "ExpandCompound")
+        }
+
+    def tearDown(self):
+        for key, value in self.saved.items():
+            if value is None:
+                self.param.RemBool(key)
+            else:
+                self.param.SetBool(key, value)
+        App.closeDocument(self.doc.Name)
+        if os.path.exists(self.fileName):
+            os.remove(self.fileName)
+
+    def importObjects(self, parallel):
+        self.param.SetBool("ParallelImport", parallel)
+        self.doc.clearDocument()
+        colors = Import.insert(self.fileName, self.doc.Name, merge=False, useLinkGroup=True)
+        self.doc.recompute()
+        objects = []
+        for obj in self.doc.Objects:
+            volume = round(obj.Shape.Volume, 6) if hasattr(obj, "Shape") else None
+            objects.append((obj.TypeId, obj.Label, volume))
+        faceColors = sorted((obj.Label, tuple(values)) for obj, values in colors or [])
+        return objects, faceColors
+
+    def testParallelImport(self):
+        """
+        Importing the shape colors in parallel gives the same objects and colors
+        """
+        box = self.doc.addObject("Part::Box", "Box")
+        cylinder = self.doc.addObject("Part::Cylinder", "Cylinder")
+        cylinder.Placement.Base = App.Vector(20, 0, 0)
+        compound = self.doc.addObject("Part::Compound", "Compound")
+        compound.Links = [
+            self.doc.addObject("Part::Box", "Box001"),
+            self.doc.addObject("Part::Sphere", "Sphere"),
+        ]
+        compound.Links[0].Placement.Base = App.Vector(0, 20, 0)
+        compound.Links[1].Placement.Base = App.Vector(20, 20, 0)
+        self.doc.recompute()
+
+        red = (1.0, 0.0, 0.0, 0.0)
+        green = (0.0, 1.0, 0.0, 0.0)
+        blue = (0.0, 0.0, 1.0, 0.0)
+        Import.export(
+            [(box, [red, green, red, green, blue, blue]), (cylinder, [green, red, blue]), compound],
+            self.fileName,
+        )
+
+        self.param.SetBool("ExpandCompound", True)
+        serial = self.importObjects(False)
+        parallel = self.importObjects(True)
+
+        self.assertGreater(len(serial[0]), 3)
+        self.assertTrue(any(len(values) == 6 for label, values in serial[1]))
+        self.assertEqual(parallel, serial)
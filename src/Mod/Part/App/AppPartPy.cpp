@@ -601,6 +601,14 @@ public:
         add_varargs_method("clearShapeCache",&Module::clearShapeCache,
             "clearShapeCache() -- Clears internal shape cache"
         );
+        add_varargs_method("getShapeCacheInfo",&Module::getShapeCacheInfo,
+            "getShapeCacheInfo() -> dict\n"
+            "Return capacity and size in bytes, number of entries and the hit,\n"
+            "miss and eviction counters of the internal shape cache"
+        );
+        add_varargs_method("setShapeCacheCapacity",&Module::setShapeCacheCapacity,
+            "setShapeCacheCapacity(bytes) -- Set the memory budget of the internal shape cache, 0 for unlimited"
+        );
         add_keyword_method("getShape",&Module::getShape,
             "getShape(obj,subname=None,mat=None,needSubElement=False,transform=True,retType=0):\n"
             "Obtain the TopoShape of a given object with SubName reference\n\n"
@@ -2328,6 +2336,28 @@ private:
         return Py::Object();
     }
 
+    Py::Object getShapeCacheInfo(const Py::Tuple &args) {
+        if (!PyArg_ParseTuple(args.ptr(),""))
+            throw Py::Exception();
+        auto stats = Part::PropertyShapeCache::getStatistics();
+        Py::Dict dict;
+        dict.setItem("Capacity", Py::Long(static_cast<unsigned long>(stats.capacity)));
+        dict.setItem("Size", Py::Long(static_cast<unsigned long>(stats.size)));
+        dict.setItem("Entries", Py::Long(static_cast<unsigned long>(stats.entries)));
+        dict.setItem("Hits", Py::Long(static_cast<unsigned long>(stats.hits)));
+        dict.setItem("Misses", Py::Long(static_cast<unsigned long>(stats.misses)));
+        dict.setItem("Evictions", Py::Long(static_cast<unsigned long>(stats.evictions)));
+        return dict;
+    }
+
+    Py::Object setShapeCacheCapacity(const Py::Tuple &args) {
+        unsigned long long capacity;
+        if (!PyArg_ParseTuple(args.ptr(),"K",&capacity))
+            throw Py::Exception();
+        Part::PropertyShapeCache::setCapacity(static_cast<std::size_t>(capacity));
+        return Py::Object();
+    }
+
     Py::Object splitSubname(const Py::Tuple& args) {
         const char *subname;
         if (!PyArg_ParseTuple(args.ptr(), "s",&subname))
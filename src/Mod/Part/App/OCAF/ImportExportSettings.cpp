@@ -272,6 +272,16 @@ bool ImportExportSettings::getShowProgress() const
     return pGroup->GetBool("ShowProgress", true);
 }
 
+void ImportExportSettings::setParallelImport(bool on)
+{
+    pGroup->SetBool("ParallelImport", on);
+}
+
+bool ImportExportSettings::getParallelImport() const
+{
+    return pGroup->GetBool("ParallelImport", true);
+}
+
 void ImportExportSettings::setImportMode(ImportExportSettings::ImportMode mode)
 {
     pGroup->SetInt("ImportMode", static_cast<long>(mode));
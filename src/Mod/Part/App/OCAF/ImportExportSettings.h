@@ -95,6 +95,9 @@ public:
     void setShowProgress(bool);
     bool getShowProgress() const;
 
+    void setParallelImport(bool);
+    bool getParallelImport() const;
+
     void setImportMode(ImportMode);
     ImportMode getImportMode() const;
 
@@ -896,9 +896,8 @@ void Feature::setMaterialAppearance(const App::Material& material)
     }
 }
 
-// Toponaming project March 2024:  This method should be going away when we get to the python layer.
 void Feature::clearShapeCache() {
-//    _ShapeCache.cache.clear();
+    PropertyShapeCache::clearAll();
 }
 
 static TopoShape _getTopoShape(const App::DocumentObject* obj,
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <mutex>
 # include <sstream>
 # include <Bnd_Box.hxx>
 # include <BRepBndLib.hxx>
@@ -867,12 +868,211 @@ void PropertyFilletEdges::Paste(const Property &from)
 
 TYPESYSTEM_SOURCE(Part::PropertyShapeCache, App::Property);
 
+namespace Part {
+
+/// Process wide least recently used list of all PropertyShapeCache entries
+class ShapeCacheManager
+{
+public:
+    using CacheEntry = PropertyShapeCache::CacheEntry;
+
+    static ShapeCacheManager &instance()
+    {
+        static ShapeCacheManager manager;
+        return manager;
+    }
+
+    std::mutex mutex;
+    PropertyShapeCache::Statistics stats;
+
+    // Move an entry to the front of the list on a cache hit
+    void touch(CacheEntry &entry)
+    {
+        if (&entry == head) {
+            return;
+        }
+        unlink(entry);
+        pushFront(entry);
+    }
+
+    // Measured outside of the lock, walking a shape can take a while
+    struct Cost {
+        explicit Cost(const TopoShape &shape)
+            : elements(shape.getElementMapSize(false) * ElementCost)
+            , geometry(shape.isNull() ? 0 : shape.getMemSize())
+        {}
+        std::size_t elements;
+        std::size_t geometry;
+    };
+
+    void add(CacheEntry &entry, const Cost &cost)
+    {
+        entry.cost = sizeof(CacheEntry) + entry.key->size() + cost.elements;
+        if (!entry.shape.isNull()) {
+            // The geometry of identical resolved sub-shapes (e.g. the same linked
+            // object shown in several documents) is shared between the entries.
+            entry.geometry = entry.shape.getShape().TShape().get();
+            auto &geo = geometries[entry.geometry];
+            if (geo.refs++ == 0) {
+                geo.cost = cost.geometry;
+                stats.size += geo.cost;
+            }
+        }
+        stats.size += entry.cost;
+        ++stats.entries;
+        pushFront(entry);
+        evict(&entry);
+    }
+
+    // Unlink an entry that is about to be erased from its owner
+    void remove(CacheEntry &entry)
+    {
+        unlink(entry);
+        stats.size -= entry.cost;
+        --stats.entries;
+        if (entry.geometry) {
+            auto it = geometries.find(entry.geometry);
+            if (it != geometries.end() && --it->second.refs == 0) {
+                stats.size -= it->second.cost;
+                geometries.erase(it);
+            }
+            entry.geometry = nullptr;
+        }
+    }
+
+    void setCapacity(std::size_t bytes)
+    {
+        stats.capacity = bytes;
+        evict(nullptr);
+    }
+
+    void clearAll()
+    {
+        while (tail) {
+            erase(*tail);
+        }
+    }
+
+private:
+    ShapeCacheManager()
+    {
+        const std::size_t megaByte = 1024 * 1024;
+        stats.capacity = static_cast<std::size_t>(App::GetApplication().GetParameterGroupByPath
+            ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetUnsigned("ShapeCacheSize", 1024))
+            * megaByte;
+    }
+
+    // Drop the least recently used entries until the cache fits into the capacity
+    void evict(const CacheEntry *keep)
+    {
+        if (stats.capacity == 0) {
+            return;
+        }
+        while (stats.size > stats.capacity && tail && tail != keep) {
+            erase(*tail);
+            ++stats.evictions;
+        }
+    }
+
+    void erase(CacheEntry &entry)
+    {
+        remove(entry);
+        entry.owner->cache.erase(*entry.key);
+    }
+
+    void pushFront(CacheEntry &entry)
+    {
+        entry.prev = nullptr;
+        entry.next = head;
+        if (head) {
+            head->prev = &entry;
+        }
+        head = &entry;
+        if (!tail) {
+            tail = &entry;
+        }
+    }
+
+    void unlink(CacheEntry &entry)
+    {
+        if (entry.prev) {
+            entry.prev->next = entry.next;
+        }
+        else {
+            head = entry.next;
+        }
+        if (entry.next) {
+            entry.next->prev = entry.prev;
+        }
+        else {
+            tail = entry.prev;
+        }
+        entry.prev = entry.next = nullptr;
+    }
+
+    struct GeometryCost {
+        std::size_t cost = 0;
+        int refs = 0;
+    };
+    std::unordered_map<const void*, GeometryCost> geometries;
+    CacheEntry *head = nullptr;
+    CacheEntry *tail = nullptr;
+
+    // Rough size of one element map entry
+    static constexpr std::size_t ElementCost = 64;
+};
+
+} // namespace Part
+
+PropertyShapeCache::~PropertyShapeCache()
+{
+    clearCache();
+}
+
+void PropertyShapeCache::clearCache()
+{
+    auto &manager = ShapeCacheManager::instance();
+    std::lock_guard<std::mutex> lock(manager.mutex);
+    for (auto &v : cache) {
+        manager.remove(v.second);
+    }
+    cache.clear();
+}
+
+PropertyShapeCache::Statistics PropertyShapeCache::getStatistics()
+{
+    auto &manager = ShapeCacheManager::instance();
+    std::lock_guard<std::mutex> lock(manager.mutex);
+    return manager.stats;
+}
+
+void PropertyShapeCache::resetStatistics()
+{
+    auto &manager = ShapeCacheManager::instance();
+    std::lock_guard<std::mutex> lock(manager.mutex);
+    manager.stats.hits = manager.stats.misses = manager.stats.evictions = 0;
+}
+
+void PropertyShapeCache::setCapacity(std::size_t bytes)
+{
+    auto &manager = ShapeCacheManager::instance();
+    std::lock_guard<std::mutex> lock(manager.mutex);
+    manager.setCapacity(bytes);
+}
+
+void PropertyShapeCache::clearAll()
+{
+    auto &manager = ShapeCacheManager::instance();
+    std::lock_guard<std::mutex> lock(manager.mutex);
+    manager.clearAll();
+}
+
 App::Property *PropertyShapeCache::Copy(void) const {
     return new PropertyShapeCache();
 }
 
 void PropertyShapeCache::Paste(const App::Property &) {
-    cache.clear();
+    clearCache();
 }
 
 void PropertyShapeCache::Save (Base::Writer &) const
@@ -888,8 +1088,16 @@ void PropertyShapeCache::Restore(Base::XMLReader &)
  * @return the python list
  */
 PyObject *PropertyShapeCache::getPyObject() {
+    std::vector<std::pair<std::string, TopoShape>> entries;
+    {
+        auto &manager = ShapeCacheManager::instance();
+        std::lock_guard<std::mutex> lock(manager.mutex);
+        entries.reserve(cache.size());
+        for(auto &v : cache)
+            entries.emplace_back(v.first, v.second.shape);
+    }
     Py::List res;
-    for(auto &v : cache)
+    for(auto &v : entries)
         res.append(Py::TupleN(Py::String(v.first),shape2pyshape(v.second)));
     return Py::new_reference_to(res);
 }
@@ -902,13 +1110,20 @@ void PropertyShapeCache::setPyObject(PyObject *value) {
     if(!value)
         return;
     if(value == Py_None) {
-        cache.clear();
+        clearCache();
         return;
     }
     App::PropertyStringList prop;
     prop.setPyObject(value);
-    for(const auto &sub : prop.getValues())
-        cache.erase(sub);
+    auto &manager = ShapeCacheManager::instance();
+    std::lock_guard<std::mutex> lock(manager.mutex);
+    for(const auto &sub : prop.getValues()) {
+        auto it = cache.find(sub);
+        if(it == cache.end())
+            continue;
+        manager.remove(it->second);
+        cache.erase(it);
+    }
 }
 
 #define SHAPE_CACHE_NAME "_Part_ShapeCache"
@@ -951,14 +1166,21 @@ bool PropertyShapeCache::getShape(const App::DocumentObject *obj, TopoShape &sha
 //    if (PartParams::getDisableShapeCache())
 //        return false;
     auto prop = get(obj,false);
-    if(!prop)
+    auto &manager = ShapeCacheManager::instance();
+    std::lock_guard<std::mutex> lock(manager.mutex);
+    if(!prop) {
+        ++manager.stats.misses;
         return false;
+    }
     if(!subname) subname = "";
     auto it = prop->cache.find(subname);
     if(it!=prop->cache.end()) {
-        shape = it->second;
+        ++manager.stats.hits;
+        manager.touch(it->second);
+        shape = it->second.shape;
         return !shape.isNull();
     }
+    ++manager.stats.misses;
     return false;
 }
 
@@ -979,7 +1201,17 @@ void PropertyShapeCache::setShape(
     if(!prop)
         return;
     if(!subname) subname = "";
-    prop->cache[subname] = shape;
+    ShapeCacheManager::Cost cost(shape);
+    auto &manager = ShapeCacheManager::instance();
+    std::lock_guard<std::mutex> lock(manager.mutex);
+    auto res = prop->cache.emplace(subname, CacheEntry());
+    auto &entry = res.first->second;
+    if(!res.second)
+        manager.remove(entry);
+    entry.shape = shape;
+    entry.owner = prop;
+    entry.key = &res.first->first;
+    manager.add(entry, cost);
 }
 
 void PropertyShapeCache::slotChanged(const App::DocumentObject &, const App::Property &prop) {
@@ -990,7 +1222,7 @@ void PropertyShapeCache::slotChanged(const App::DocumentObject &, const App::Pro
         strstr(propName,"Touched")!=0)
     {
         FC_LOG("clear shape cache on changed " << prop.getFullName());
-        cache.clear();
+        clearCache();
     }
 }
 
@@ -257,9 +257,18 @@ private:
 };
 
 
+/** Per object cache of resolved sub-shapes
+ *
+ * All entries of all caches in the process share one memory budget. When the
+ * estimated size of the cached shapes exceeds the capacity, the least recently
+ * used entries are dropped. Geometry shared by several entries, e.g. the same
+ * linked shape resolved from several documents, is only counted once.
+ */
 class PartExport PropertyShapeCache: public App::Property {
     TYPESYSTEM_HEADER_WITH_OVERRIDE();
 public:
+    ~PropertyShapeCache() override;
+
     virtual App::Property *Copy(void) const override;
 
     virtual void Paste(const App::Property &) override;
@@ -276,11 +285,39 @@ public:
     static bool getShape(const App::DocumentObject *obj, TopoShape &shape, const char *subname=0);
     static void setShape(const App::DocumentObject *obj, const TopoShape &shape, const char *subname=0);
 
+    struct Statistics {
+        std::size_t capacity = 0;
+        std::size_t size = 0;
+        std::size_t entries = 0;
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t evictions = 0;
+    };
+    /// Counters of the process wide cache
+    static Statistics getStatistics();
+    static void resetStatistics();
+    /// Set the memory budget in bytes of all caches, 0 means unlimited
+    static void setCapacity(std::size_t bytes);
+    /// Remove all entries from all caches
+    static void clearAll();
+
 private:
     void slotChanged(const App::DocumentObject &, const App::Property &prop);
+    void clearCache();
+
+    struct CacheEntry {
+        TopoShape shape;
+        std::size_t cost = 0;
+        const void *geometry = nullptr;
+        PropertyShapeCache *owner = nullptr;
+        const std::string *key = nullptr;
+        CacheEntry *prev = nullptr;
+        CacheEntry *next = nullptr;
+    };
+    friend class ShapeCacheManager;
 
 private:
-    std::unordered_map<std::string, TopoShape> cache;
+    std::unordered_map<std::string, CacheEntry> cache;
     boost::signals2::scoped_connection connChanged;
 };
 
@@ -31,6 +31,7 @@
 #include <Base/Exception.h>
 #include <Mod/Part/PartGlobal.h>
 
+#include <TopAbs_State.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Wire.hxx>
 #include <TopTools_ListOfShape.hxx>
@@ -47,6 +48,7 @@
 class gp_Ax1;
 class gp_Ax2;
 class gp_Pln;
+class gp_Pnt2d;
 class gp_Vec;
 
 namespace App
@@ -497,6 +499,34 @@ public:
     bool isPlanarFace(double tol=1e-7) const;   // NOLINT
     //@}
 
+    /** @name Batch point queries
+     *
+     * The OCC query structures are set up once per worker thread and reused
+     * for all the points handled by that thread. Results are in point order.
+     */
+    //@{
+    /// Minimum distance of each point to the shape, negative if it can't be computed
+    std::vector<double> distanceToPoints(const std::vector<Base::Vector3d>& points) const;
+    /** Classify points against the shape
+     *
+     * Shapes containing a solid return TopAbs_IN or TopAbs_OUT, and TopAbs_ON
+     * for points lying on a face within \a tol. Shapes without a solid return
+     * TopAbs_ON for points closer than \a tol and TopAbs_OUT otherwise.
+     */
+    std::vector<TopAbs_State> classifyPoints(const std::vector<Base::Vector3d>& points,
+                                             double tol) const;
+    /** Project points onto the surface of a face
+     *
+     * @param points: the points to project
+     * @param params: returns the (u, v) surface parameters of the nearest projection
+     * @param distances: returns the distances to the projections, negative if
+     * a point can't be projected
+     */
+    void projectPointsOnFace(const std::vector<Base::Vector3d>& points,
+                             std::vector<gp_Pnt2d>& params,
+                             std::vector<double>& distances) const;
+    //@}
+
     /** @name Boolean operation*/
     //@{
     TopoDS_Shape cut(TopoDS_Shape) const;
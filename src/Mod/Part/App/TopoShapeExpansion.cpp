@@ -34,8 +34,11 @@
 #include <BRepAdaptor_HCompCurve.hxx>
 #endif
 
+#include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepBuilderAPI_MakeWire.hxx>
 #include <BRepCheck_Analyzer.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepFill.hxx>
 #include <BRepFill_Generator.hxx>
 #include <BRepTools.hxx>
@@ -66,6 +69,7 @@
 #include <BRepPrimAPI_MakePrism.hxx>
 #include <BRepProj_Projection.hxx>
 #include <BRepTools_WireExplorer.hxx>
+#include <GeomAPI_ProjectPointOnSurf.hxx>
 #include <GeomConvert.hxx>
 #include <GeomFill_BezierCurves.hxx>
 #include <GeomFill_BSplineCurves.hxx>
@@ -78,14 +82,13 @@
 #include <ShapeFix_Shape.hxx>
 #include <ShapeFix_ShapeTolerance.hxx>
 #include <gp_Pln.hxx>
+#include <gp_Pnt2d.hxx>
 
 #include <utility>
 
 #endif
 
-#if OCC_VERSION_HEX >= 0x070500
 #include <OSD_Parallel.hxx>
-#endif
 
 #include "modelRefine.h"
 #include "CrossSection.h"
@@ -98,6 +101,7 @@
 #include "BRepOffsetAPI_MakeOffsetFix.h"
 #include "Base/Tools.h"
 #include "Base/BoundBox.h"
+#include "Base/Parallel.h"
 
 #include <App/ElementMap.h>
 #include <App/ElementNamingUtils.h>
@@ -5820,4 +5824,104 @@ bool TopoShape::getRelatedElementsCached(const Data::MappedName& name,
     return true;
 }
 
+// Batches of point queries are split into ranges handled in parallel. Every range sets up its own
+// OCC query object, so ranges should not be too small.
+static const std::size_t minPointRange = 256;
+
+std::vector<double> TopoShape::distanceToPoints(const std::vector<Base::Vector3d>& points) const
+{
+    if (isNull()) {
+        FC_THROWM(NullShapeException, "Null shape");
+    }
+    std::vector<double> distances(points.size(), -1.0);
+    Base::parallelForRanges(points.size(), minPointRange, [&](std::size_t begin, std::size_t end) {
+        BRepExtrema_DistShapeShape extss;
+        extss.LoadS2(_Shape);
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto& pnt = points[i];
+            try {
+                extss.LoadS1(BRepBuilderAPI_MakeVertex(gp_Pnt(pnt.x, pnt.y, pnt.z)).Vertex());
+                if (extss.Perform() && extss.NbSolution() > 0) {
+                    distances[i] = extss.Value();
+                }
+            }
+            catch (Standard_Failure&) {
+                // leave the distance negative
+            }
+        }
+    });
+    return distances;
+}
+
+std::vector<TopAbs_State> TopoShape::classifyPoints(const std::vector<Base::Vector3d>& points,
+                                                    double tol) const
+{
+    if (isNull()) {
+        FC_THROWM(NullShapeException, "Null shape");
+    }
+    std::vector<TopAbs_State> states(points.size(), TopAbs_UNKNOWN);
+    // shells and compounds without a solid have no inside either
+    if (!hasSubShape(TopAbs_SOLID)) {
+        auto distances = distanceToPoints(points);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            if (distances[i] >= 0.0) {
+                states[i] = distances[i] <= tol ? TopAbs_ON : TopAbs_OUT;
+            }
+        }
+        return states;
+    }
+    Base::parallelForRanges(points.size(), minPointRange, [&](std::size_t begin, std::size_t end) {
+        BRepClass3d_SolidClassifier classifier(_Shape);
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto& pnt = points[i];
+            try {
+                classifier.Perform(gp_Pnt(pnt.x, pnt.y, pnt.z), tol);
+                states[i] = classifier.IsOnAFace() ? TopAbs_ON : classifier.State();
+            }
+            catch (Standard_Failure&) {
+                // leave the state unknown
+            }
+        }
+    });
+    return states;
+}
+
+void TopoShape::projectPointsOnFace(const std::vector<Base::Vector3d>& points,
+                                    std::vector<gp_Pnt2d>& params,
+                                    std::vector<double>& distances) const
+{
+    if (isNull()) {
+        FC_THROWM(NullShapeException, "Null shape");
+    }
+    if (shapeType() != TopAbs_FACE) {
+        FC_THROWM(Base::TypeError, "Shape is not a face");
+    }
+    const TopoDS_Face& face = TopoDS::Face(_Shape);
+    Handle(Geom_Surface) surface = BRep_Tool::Surface(face);
+    Standard_Real uMin, uMax, vMin, vMax;
+    BRepTools::UVBounds(face, uMin, uMax, vMin, vMax);
+
+    params.assign(points.size(), gp_Pnt2d());
+    distances.assign(points.size(), -1.0);
+    Base::parallelForRanges(points.size(), minPointRange, [&](std::size_t begin, std::size_t end) {
+        GeomAPI_ProjectPointOnSurf projector;
+        projector.Init(surface, uMin, uMax, vMin, vMax);
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto& pnt = points[i];
+            try {
+                projector.Perform(gp_Pnt(pnt.x, pnt.y, pnt.z));
+                if (projector.NbPoints() > 0) {
+                    Standard_Real u, v;
+                    projector.LowerDistanceParameters(u, v);
+                    params[i].SetCoord(u, v);
+                    distances[i] = projector.LowerDistance();
+                }
+            }
+            catch (Standard_Failure&) {
+                // leave the distance negative
+            }
+        }
+    });
+}
+
 }  // namespace Part
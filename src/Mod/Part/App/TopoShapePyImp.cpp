@@ -47,6 +47,7 @@
 # include <gp_Dir.hxx>
 # include <gp_Pln.hxx>
 # include <gp_Pnt.hxx>
+# include <gp_Pnt2d.hxx>
 # include <gp_Trsf.hxx>
 # include <GProp_GProps.hxx>
 # include <HLRAppli_ReflectLines.hxx>
@@ -1851,6 +1852,129 @@ PyObject*  TopoShapePy::isInside(PyObject *args)
     }
 }
 
+static void getPointsFromPy(PyObject* obj, std::vector<Base::Vector3d>& points)
+{
+    // fast path for contiguous arrays of doubles, e.g. numpy arrays of shape (N, 3)
+    if (PyObject_CheckBuffer(obj)) {
+        Py_buffer view;
+        if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0) {
+            bool ok = view.format && std::string(view.format) == "d"
+                && view.itemsize == sizeof(double)
+                && (view.len / view.itemsize) % 3 == 0;
+            if (ok) {
+                const auto* data = static_cast<const double*>(view.buf);
+                Py_ssize_t count = view.len / view.itemsize / 3;
+                points.reserve(count);
+                for (Py_ssize_t i = 0; i < count; ++i) {
+                    points.emplace_back(data[3 * i], data[3 * i + 1], data[3 * i + 2]);
+                }
+            }
+            PyBuffer_Release(&view);
+            if (ok) {
+                return;
+            }
+        }
+        else {
+            PyErr_Clear();
+        }
+    }
+
+    Py::Sequence list(obj);
+    points.reserve(list.size());
+    for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+        PyObject* item = (*it).ptr();
+        if (PyObject_TypeCheck(item, &(Base::VectorPy::Type))) {
+            points.push_back(static_cast<Base::VectorPy*>(item)->value());
+        }
+        else if (PyObject_TypeCheck(item, &PyTuple_Type)) {
+            points.push_back(Base::getVectorFromTuple<double>(item));
+        }
+        else {
+            throw Py::TypeError("either vector or tuple expected");
+        }
+    }
+}
+
+PyObject* TopoShapePy::distToPoints(PyObject *args)
+{
+    PyObject *obj;
+    if (!PyArg_ParseTuple(args, "O", &obj))
+        return nullptr;
+
+    PY_TRY {
+        std::vector<Base::Vector3d> points;
+        getPointsFromPy(obj, points);
+        std::vector<double> distances = getTopoShapePtr()->distanceToPoints(points);
+
+        Py::List list(static_cast<int>(distances.size()));
+        for (std::size_t i = 0; i < distances.size(); ++i) {
+            list.setItem(i, Py::Float(distances[i]));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH_OCC
+}
+
+PyObject* TopoShapePy::classifyPoints(PyObject *args)
+{
+    PyObject *obj;
+    double tol;
+    if (!PyArg_ParseTuple(args, "Od", &obj, &tol))
+        return nullptr;
+
+    PY_TRY {
+        std::vector<Base::Vector3d> points;
+        getPointsFromPy(obj, points);
+        std::vector<TopAbs_State> states = getTopoShapePtr()->classifyPoints(points, tol);
+
+        Py::List list(static_cast<int>(states.size()));
+        for (std::size_t i = 0; i < states.size(); ++i) {
+            long value;
+            switch (states[i]) {
+            case TopAbs_IN:
+                value = 1;
+                break;
+            case TopAbs_ON:
+                value = 0;
+                break;
+            case TopAbs_OUT:
+                value = -1;
+                break;
+            default:
+                value = -2;
+                break;
+            }
+            list.setItem(i, Py::Long(value));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH_OCC
+}
+
+PyObject* TopoShapePy::projectPointsOnFace(PyObject *args)
+{
+    PyObject *obj;
+    if (!PyArg_ParseTuple(args, "O", &obj))
+        return nullptr;
+
+    PY_TRY {
+        std::vector<Base::Vector3d> points;
+        getPointsFromPy(obj, points);
+        std::vector<gp_Pnt2d> params;
+        std::vector<double> distances;
+        getTopoShapePtr()->projectPointsOnFace(points, params, distances);
+
+        Py::List uv(static_cast<int>(params.size()));
+        Py::List dist(static_cast<int>(distances.size()));
+        for (std::size_t i = 0; i < params.size(); ++i) {
+            uv.setItem(i, Py::TupleN(Py::Float(params[i].X()), Py::Float(params[i].Y())));
+            dist.setItem(i, Py::Float(distances[i]));
+        }
+        return Py::new_reference_to(Py::TupleN(uv, dist));
+    }
+    PY_CATCH_OCC
+}
+
 PyObject* TopoShapePy::removeSplitter(PyObject *args)
 {
     if (!PyArg_ParseTuple(args, ""))
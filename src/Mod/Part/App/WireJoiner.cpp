@@ -50,6 +50,7 @@
 # include <ShapeFix_Shape.hxx>
 # include <TopExp.hxx>
 # include <TopExp_Explorer.hxx>
+# include <TopoDS_Iterator.hxx>
 # include <TopTools_HSequenceOfShape.hxx>
 #endif
 
@@ -59,6 +60,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <deque>
+#include <numeric>
 #include <boost_geometry.hpp>
 #include <utility>
 
@@ -66,7 +68,9 @@
 #include <Base/Exception.h>
 #include <Base/Tools.h>
 #include <Base/Sequencer.h>
+#include <Base/Parallel.h>
 #include <Base/Parameter.h>
+#include <Base/TimeInfo.h>
 #include <App/Application.h>
 
 #include "WireJoiner.h"
@@ -117,6 +121,9 @@ public:
     bool doMergeEdge = true;
     bool doOutline = false;
     bool doTightBound = true;
+    bool doParallel = false;
+
+    WireJoiner::Statistics stats;
 
     std::string catchObject;
     int catchIteration {};
@@ -147,6 +154,23 @@ public:
               App::GetApplication()
                   .GetParameterGroupByPath("User parameter:BaseApp/Preferences/WireJoiner")
                   ->GetInt("Iteration", 0)))
+    {
+        doParallel = App::GetApplication()
+                         .GetParameterGroupByPath("User parameter:BaseApp/Preferences/WireJoiner")
+                         ->GetBool("Parallel", false);
+    }
+
+    // Joiner for one edge component of a parallel build, sharing the settings of parent
+    explicit WireJoinerP(const WireJoinerP *parent)
+        : myTol(parent->myTol)
+        , myTol2(parent->myTol2)
+        , myAngularTol(parent->myAngularTol)
+        , doSplitEdge(parent->doSplitEdge)
+        , doMergeEdge(parent->doMergeEdge)
+        , doOutline(parent->doOutline)
+        , doTightBound(parent->doTightBound)
+        , catchObject(parent->catchObject)
+        , catchIteration(parent->catchIteration)
     {}
 
     bool getBBox(const TopoDS_Shape &eForBBox, Bnd_Box &bound) {
@@ -2984,6 +3008,137 @@ public:
         }
     }
 
+    // Group the source edges into components whose tolerance enlarged bounding
+    // boxes overlap. Edges of different components can neither touch nor
+    // intersect, so each component can be joined on its own. Components are
+    // ordered by their first source edge.
+    std::vector<std::vector<int>> partitionSourceEdges() const
+    {
+        const int count = static_cast<int>(sourceEdgeArray.size());
+        std::vector<int> parent(count);
+        std::iota(parent.begin(), parent.end(), 0);
+        auto findRoot = [&parent](int idx) {
+            while (parent[idx] != idx) {
+                parent[idx] = parent[parent[idx]];
+                idx = parent[idx];
+            }
+            return idx;
+        };
+
+        using BoxValue = std::pair<Box, int>;
+        std::vector<BoxValue> boxes;
+        boxes.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            Bnd_Box bound;
+            BRepBndLib::Add(sourceEdgeArray[i].getShape(), bound);
+            if (bound.IsVoid()) {
+                continue;
+            }
+            bound.Enlarge(myTol);
+            Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+            bound.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+            boxes.emplace_back(Box(gp_Pnt(xMin, yMin, zMin), gp_Pnt(xMax, yMax, zMax)), i);
+        }
+
+        bgi::rtree<BoxValue, RParameters> tree(boxes.begin(), boxes.end());
+        for (const auto& value : boxes) {
+            for (auto it = tree.qbegin(bgi::intersects(value.first)); it != tree.qend(); ++it) {
+                int root1 = findRoot(value.second);
+                int root2 = findRoot(it->second);
+                if (root1 != root2) {
+                    parent[std::max(root1, root2)] = std::min(root1, root2);
+                }
+            }
+        }
+
+        // The smaller index always becomes the root, so roots appear in
+        // ascending order of their first edge.
+        std::vector<std::vector<int>> components;
+        std::vector<int> componentIndex(count, -1);
+        for (int i = 0; i < count; ++i) {
+            int root = findRoot(i);
+            if (componentIndex[root] < 0) {
+                componentIndex[root] = static_cast<int>(components.size());
+                components.emplace_back();
+            }
+            components[componentIndex[root]].push_back(i);
+        }
+        return components;
+    }
+
+    void buildParallel()
+    {
+        Base::TimeElapsed timer;
+        auto components = partitionSourceEdges();
+        stats.componentCount = components.size();
+        stats.partitionTime = Base::TimeElapsed::diffTimeF(timer);
+        if (components.size() < 2) {
+            timer = Base::TimeElapsed();
+            build();
+            stats.joinTime = Base::TimeElapsed::diffTimeF(timer);
+            return;
+        }
+
+        std::vector<std::unique_ptr<WireJoinerP>> joiners;
+        joiners.reserve(components.size());
+        for (const auto& component : components) {
+            joiners.push_back(std::make_unique<WireJoinerP>(this));
+            auto& joiner = *joiners.back();
+            joiner.sourceEdgeArray.reserve(component.size());
+            for (int idx : component) {
+                joiner.sourceEdgeArray.push_back(sourceEdgeArray[idx]);
+            }
+        }
+
+        timer = Base::TimeElapsed();
+        Base::parallelFor(joiners.size(), [&](std::size_t idx) {
+            joiners[idx]->build();
+        });
+        stats.joinTime = Base::TimeElapsed::diffTimeF(timer);
+
+        timer = Base::TimeElapsed();
+        clear();
+        sourceEdges.clear();
+        for (auto& joiner : joiners) {
+            sourceEdges.insert(joiner->sourceEdges.begin(), joiner->sourceEdges.end());
+            for (TopoDS_Iterator it(joiner->compound); it.More(); it.Next()) {
+                builder.Add(compound, it.Value());
+            }
+            if (!joiner->openWireCompound.IsNull()) {
+                if (openWireCompound.IsNull()) {
+                    builder.MakeCompound(openWireCompound);
+                }
+                for (TopoDS_Iterator it(joiner->openWireCompound); it.More(); it.Next()) {
+                    builder.Add(openWireCompound, it.Value());
+                }
+            }
+            // The components share no shapes, so merging just collects their entries
+            aHistory->Merge(joiner->aHistory);
+        }
+        stats.mergeTime = Base::TimeElapsed::diffTimeF(timer);
+    }
+
+    void run()
+    {
+        stats = WireJoiner::Statistics();
+        stats.edgeCount = sourceEdgeArray.size();
+        stats.componentCount = 1;
+        // Debug shapes are added to the active document, which must not happen
+        // from worker threads.
+        bool debugging = catchIteration > 0 || FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_TRACE);
+        if (doParallel && !debugging) {
+            buildParallel();
+        }
+        else {
+            Base::TimeElapsed timer;
+            build();
+            stats.joinTime = Base::TimeElapsed::diffTimeF(timer);
+        }
+        FC_LOG("edges: " << stats.edgeCount << ", components: " << stats.componentCount
+                         << ", partition: " << stats.partitionTime << "s, join: "
+                         << stats.joinTime << "s, merge: " << stats.mergeTime << 's');
+    }
+
     void addWire(std::shared_ptr<WireInfo> &wireInfo)
     {
         if (!wireInfo || !wireInfo->done || !wireSet.insertUnique(wireInfo.get())) {
@@ -3120,6 +3275,19 @@ void WireJoiner::setMergeEdges(bool enable)
     }
 }
 
+void WireJoiner::setParallel(bool enable)
+{
+    if (enable != pimpl->doParallel) {
+        NotDone();
+        pimpl->doParallel = enable;
+    }
+}
+
+const WireJoiner::Statistics &WireJoiner::getStatistics() const
+{
+    return pimpl->stats;
+}
+
 void WireJoiner::setTolerance(double tol, double atol)
 {
     if (tol >= 0 && tol != pimpl->myTol) {
@@ -3144,7 +3312,7 @@ void WireJoiner::Build(const Message_ProgressRange& theRange)
     if (IsDone()) {
         return;
     }
-    pimpl->build();
+    pimpl->run();
     if (TopoShape(pimpl->compound).countSubShapes(TopAbs_SHAPE) > 0) {
         myShape = pimpl->compound;
     }
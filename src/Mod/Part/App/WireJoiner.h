@@ -35,6 +35,15 @@ public:
     WireJoiner();
     ~WireJoiner() override;
 
+    /// Size and timing figures of the last build, in seconds
+    struct Statistics {
+        std::size_t edgeCount = 0;
+        std::size_t componentCount = 0;
+        double partitionTime = 0.0;
+        double joinTime = 0.0;
+        double mergeTime = 0.0;
+    };
+
     void addShape(const TopoShape &shape);
     void addShape(const std::vector<TopoShape> &shapes);
     void addShape(const std::vector<TopoDS_Shape> &shapes);
@@ -44,6 +53,16 @@ public:
     void setSplitEdges(bool enable=true);
     void setMergeEdges(bool enable=true);
     void setTolerance(double tolerance, double atol=0.0);
+    /** Join independent groups of edges concurrently
+     *
+     * The input edges are partitioned into connected components by their
+     * bounding boxes. Each component is joined on its own thread and the
+     * results are merged in the order of the first input edge of each
+     * component.
+     */
+    void setParallel(bool enable=true);
+
+    const Statistics &getStatistics() const;
 
     bool getOpenWires(TopoShape &shape, const char *op="", bool noOriginal=true);
     bool getResultWires(TopoShape &shape, const char *op="");
@@ -63,15 +63,19 @@
 # include <TopExp_Explorer.hxx>
 # include <TopTools_DataMapIteratorOfDataMapOfIntegerListOfShape.hxx>
 # include <TopTools_DataMapIteratorOfDataMapOfShapeShape.hxx>
+# include <TopTools_IndexedMapOfShape.hxx>
 # include <TopTools_ListIteratorOfListOfShape.hxx>
 # include <TopTools_ListOfShape.hxx>
 #endif // _PreComp_
 
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 
 #include "modelRefine.h"
 
 
+FC_LOG_LEVEL_INIT("Part", true, true)
+
 using namespace ModelRefine;
 
 
@@ -85,33 +89,29 @@ void ModelRefine::getFaceEdges(const TopoDS_Face &face, EdgeVectorType &edges)
 void ModelRefine::boundaryEdges(const FaceVectorType &faces, EdgeVectorType &edgesOut)
 {
     //this finds all the boundary edges. Maybe more than one boundary.
-    std::list<TopoDS_Edge> edges;
+    //An edge shared by two faces of the set is interior, so only edges that are
+    //referenced an odd number of times are kept, in order of first appearance.
+    TopTools_IndexedMapOfShape edgeMap;
+    std::vector<int> edgeCount;
     FaceVectorType::const_iterator faceIt;
     for (faceIt = faces.begin(); faceIt != faces.end(); ++faceIt)
     {
-        EdgeVectorType faceEdges;
-        EdgeVectorType::iterator faceEdgesIt;
-        getFaceEdges(*faceIt, faceEdges);
-        for (faceEdgesIt = faceEdges.begin(); faceEdgesIt != faceEdges.end(); ++faceEdgesIt)
+        TopExp_Explorer it;
+        for (it.Init(*faceIt, TopAbs_EDGE); it.More(); it.Next())
         {
-            bool foundSignal(false);
-            std::list<TopoDS_Edge>::iterator edgesIt;
-            for (edgesIt = edges.begin(); edgesIt != edges.end(); ++edgesIt)
-            {
-                if ((*edgesIt).IsSame(*faceEdgesIt))
-                {
-                    edgesIt = edges.erase(edgesIt);
-                    foundSignal = true;
-                    break;
-                }
-            }
-            if (!foundSignal)
-                edges.push_back(*faceEdgesIt);
+            int index = edgeMap.Add(it.Current());
+            if (index > static_cast<int>(edgeCount.size()))
+                edgeCount.push_back(0);
+            ++edgeCount[index - 1];
         }
     }
 
-    edgesOut.reserve(edges.size());
-    std::copy(edges.begin(), edges.end(), back_inserter(edgesOut));
+    edgesOut.reserve(edgesOut.size() + edgeMap.Extent());
+    for (int index = 1; index <= edgeMap.Extent(); ++index)
+    {
+        if (edgeCount[index - 1] % 2 != 0)
+            edgesOut.push_back(TopoDS::Edge(edgeMap(index)));
+    }
 }
 
 TopoDS_Shell ModelRefine::removeFaces(const TopoDS_Shell &shell, const FaceVectorType &faces)
@@ -255,36 +255,86 @@ void FaceAdjacencySplitter::recursiveFind(const TopoDS_Face &face, FaceVectorTyp
 
 void FaceEqualitySplitter::split(const FaceVectorType &faces, FaceTypedBase *object)
 {
-    std::vector<FaceVectorType> tempVector;
-    tempVector.reserve(faces.size());
-    FaceVectorType::const_iterator faceIt;
-    for (faceIt = faces.begin(); faceIt != faces.end(); ++faceIt)
+    //Comparing every face with every group is quadratic in the number of faces. So
+    //faces are first sorted by a scalar surface key and cut into buckets wherever two
+    //consecutive keys are further apart than any equal pair can be. Each bucket is
+    //then split independently, in parallel, with the pairwise isEqual check.
+    std::vector<std::pair<double, int>> keyed;
+    keyed.reserve(faces.size());
+    IndexGroupType unkeyed;
+    double maxTolerance(0.0);
+    for (std::size_t index = 0; index < faces.size(); ++index)
+    {
+        double key, tolerance;
+        if (object->getSignature(faces[index], key, tolerance))
+        {
+            keyed.emplace_back(key, static_cast<int>(index));
+            maxTolerance = std::max(maxTolerance, tolerance);
+        }
+        else
+            unkeyed.push_back(static_cast<int>(index));
+    }
+    std::sort(keyed.begin(), keyed.end());
+
+    std::vector<IndexGroupType> buckets;
+    for (std::size_t index = 0; index < keyed.size(); ++index)
+    {
+        if (index == 0 || keyed[index].first - keyed[index - 1].first > maxTolerance)
+            buckets.emplace_back();
+        buckets.back().push_back(keyed[index].second);
+    }
+    if (!unkeyed.empty())
+        buckets.push_back(unkeyed);
+    //keep the input order inside a bucket so that group fronts match the serial result.
+    for (auto &bucket : buckets)
+        std::sort(bucket.begin(), bucket.end());
+
+    std::vector<std::vector<IndexGroupType>> bucketGroups(buckets.size());
+    Base::parallelFor(buckets.size(), [&](std::size_t index) {
+        splitBucket(faces, buckets[index], object, bucketGroups[index]);
+    });
+
+    //order groups by their first face, as the serial pairwise split did.
+    std::vector<IndexGroupType> groups;
+    for (auto &bucket : bucketGroups)
+        std::move(bucket.begin(), bucket.end(), std::back_inserter(groups));
+    std::sort(groups.begin(), groups.end(), [](const IndexGroupType &a, const IndexGroupType &b) {
+        return a.front() < b.front();
+    });
+    for (const auto &group : groups)
+    {
+        FaceVectorType equalFaces;
+        equalFaces.reserve(group.size());
+        for (int index : group)
+            equalFaces.push_back(faces[index]);
+        equalityVector.push_back(equalFaces);
+    }
+}
+
+void FaceEqualitySplitter::splitBucket(const FaceVectorType &faces, const IndexGroupType &bucket,
+                                       const FaceTypedBase *object, std::vector<IndexGroupType> &groupsOut)
+{
+    std::vector<IndexGroupType> tempVector;
+    for (int faceIndex : bucket)
     {
         bool foundMatch(false);
-        std::vector<FaceVectorType>::iterator tempIt;
-        for (tempIt = tempVector.begin(); tempIt != tempVector.end(); ++tempIt)
+        for (auto &temp : tempVector)
         {
-            if (object->isEqual((*tempIt).front(), *faceIt))
+            if (object->isEqual(faces[temp.front()], faces[faceIndex]))
             {
-                (*tempIt).push_back(*faceIt);
+                temp.push_back(faceIndex);
                 foundMatch = true;
                 break;
             }
         }
         if (!foundMatch)
-        {
-            FaceVectorType another;
-            another.reserve(faces.size());
-            another.push_back(*faceIt);
-            tempVector.push_back(another);
-        }
+            tempVector.push_back(IndexGroupType(1, faceIndex));
     }
-    std::vector<FaceVectorType>::iterator it;
-    for (it = tempVector.begin(); it != tempVector.end(); ++it)
+    for (auto &temp : tempVector)
     {
-        if ((*it).size() < 2)
+        if (temp.size() < 2)
             continue;
-        equalityVector.push_back(*it);
+        groupsOut.push_back(std::move(temp));
     }
 }
 
@@ -297,6 +347,11 @@ GeomAbs_SurfaceType FaceTypedBase::getFaceType(const TopoDS_Face &faceIn)
     return surfaceTest.GetType();
 }
 
+bool FaceTypedBase::getSignature(const TopoDS_Face &/*face*/, double &/*key*/, double &/*tolerance*/) const
+{
+    return false;
+}
+
 void FaceTypedBase::boundarySplit(const FaceVectorType &facesIn, std::vector<EdgeVectorType> &boundariesOut) const
 {
     EdgeVectorType bEdges;
@@ -381,6 +436,22 @@ bool FaceTypedPlane::isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &face
             planeOne.Distance(planeTwo.Position().Location()) < Precision::Confusion());
 }
 
+bool FaceTypedPlane::getSignature(const TopoDS_Face &face, double &key, double &tolerance) const
+{
+    Handle(Geom_Plane) planeSurface = getGeomPlane(face);
+    if (planeSurface.IsNull())
+        return false;
+
+    //distance of the plane to the origin doesn't depend on the normal direction.
+    //The parallel check in isEqual() allows a small angle between the normals, which
+    //shifts this distance proportional to how far the plane location is from the origin.
+    gp_Pln plane(planeSurface->Pln());
+    const gp_XYZ &location = plane.Location().XYZ();
+    key = fabs(plane.Axis().Direction().XYZ().Dot(location));
+    tolerance = 2.0 * Precision::Confusion() * (1.0 + location.Modulus());
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedPlane::getType() const
 {
     return GeomAbs_Plane;
@@ -477,6 +548,17 @@ bool FaceTypedCylinder::isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &f
     return true;
 }
 
+bool FaceTypedCylinder::getSignature(const TopoDS_Face &face, double &key, double &tolerance) const
+{
+    Handle(Geom_CylindricalSurface) cylinderSurface = getGeomCylinder(face);
+    if (cylinderSurface.IsNull())
+        return false;
+
+    key = cylinderSurface->Radius();
+    tolerance = Precision::Confusion();
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedCylinder::getType() const
 {
     return GeomAbs_Cylinder;
@@ -1164,18 +1246,29 @@ bool FaceUniter::process()
             }
         }
         // update the list of modifications
+        // Index the united faces once, so that each fused face is looked up directly
+        // instead of scanning all modifications. Note: IsEqual() for some reason does
+        // not work, the map compares with IsSame().
+        TopTools_IndexedMapOfShape unitedFaces;
+        std::vector<std::vector<std::size_t>> unitedFaceUses;
+        for (std::size_t index = 0; index < modifiedShapes.size(); ++index)
+        {
+            int faceIndex = unitedFaces.Add(modifiedShapes[index].second);
+            if (faceIndex > static_cast<int>(unitedFaceUses.size()))
+                unitedFaceUses.emplace_back();
+            unitedFaceUses[faceIndex - 1].push_back(index);
+        }
         TopTools_DataMapOfShapeShape faceMap;
         edgeFuse.Faces(faceMap);
         for (mapIt.Initialize(faceMap); mapIt.More(); mapIt.Next())
         {
             bool isModifiedFace = false;
-            for (auto & it : modifiedShapes)
+            int faceIndex = unitedFaces.FindIndex(mapIt.Key());
+            if (faceIndex > 0)
             {
-                if (mapIt.Key().IsSame(it.second)) {
-                    // Note: IsEqual() for some reason does not work
-                    it.second = mapIt.Value();
-                    isModifiedFace = true;
-                }
+                for (std::size_t index : unitedFaceUses[faceIndex - 1])
+                    modifiedShapes[index].second = mapIt.Value();
+                isModifiedFace = true;
             }
             if (!isModifiedFace)
             {
@@ -1226,6 +1319,8 @@ void Part::BRepBuilderAPI_RefineModel::Build()
     if (myShape.IsNull())
         Standard_Failure::Raise("Cannot remove splitter from empty shape");
 
+    FC_TIME_INIT(t);
+
     if (myShape.ShapeType() == TopAbs_SOLID) {
         const TopoDS_Solid &solid = TopoDS::Solid(myShape);
         BRepBuilderAPI_MakeSolid mkSolid;
@@ -1315,6 +1410,7 @@ void Part::BRepBuilderAPI_RefineModel::Build()
         myShape = comp;
     }
 
+    FC_TIME_LOG(t, "refine model");
     Done();
 }
 
@@ -1328,7 +1424,7 @@ void Part::BRepBuilderAPI_RefineModel::LogModifications(const ModelRefine::FaceU
     }
     const ShapeVectorType& delShapes = uniter.getDeletedShapes();
     for (const auto & it : delShapes) {
-        myDeleted.Append(it);
+        myDeleted.Add(it);
     }
 }
 
@@ -1342,13 +1438,5 @@ const TopTools_ListOfShape& Part::BRepBuilderAPI_RefineModel::Modified(const Top
 
 Standard_Boolean Part::BRepBuilderAPI_RefineModel::IsDeleted(const TopoDS_Shape& S)
 {
-    TopTools_ListIteratorOfListOfShape it;
-    for (it.Initialize(myDeleted); it.More(); it.Next())
-    {
-        if (it.Value().IsSame(S))
-            return Standard_True;
-    }
-
-    return Standard_False;
+    return myDeleted.Contains(S);
 }
-
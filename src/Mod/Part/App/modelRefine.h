@@ -63,6 +63,10 @@ namespace ModelRefine
         virtual bool isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &faceTwo) const = 0;
         virtual GeomAbs_SurfaceType getType() const = 0;
         virtual TopoDS_Face buildFace(const FaceVectorType &faces) const = 0;
+        /// Scalar key used to bucket faces before the pairwise isEqual() check. Faces
+        /// that are equal must have keys closer than \a tolerance. Returns false if
+        /// the face has no usable key.
+        virtual bool getSignature(const TopoDS_Face &face, double &key, double &tolerance) const;
 
         static GeomAbs_SurfaceType getFaceType(const TopoDS_Face &faceIn);
 
@@ -79,6 +83,7 @@ namespace ModelRefine
         bool isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &faceTwo) const override;
         GeomAbs_SurfaceType getType() const override;
         TopoDS_Face buildFace(const FaceVectorType &faces) const override;
+        bool getSignature(const TopoDS_Face &face, double &key, double &tolerance) const override;
         friend FaceTypedPlane& getPlaneObject();
     };
     FaceTypedPlane& getPlaneObject();
@@ -91,6 +96,7 @@ namespace ModelRefine
         bool isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &faceTwo) const override;
         GeomAbs_SurfaceType getType() const override;
         TopoDS_Face buildFace(const FaceVectorType &faces) const override;
+        bool getSignature(const TopoDS_Face &face, double &key, double &tolerance) const override;
         friend FaceTypedCylinder& getCylinderObject();
 
     protected:
@@ -153,6 +159,9 @@ namespace ModelRefine
         const FaceVectorType& getGroup(const std::size_t &index) const {return equalityVector[index];}
 
     private:
+        using IndexGroupType = std::vector<int>;
+        static void splitBucket(const FaceVectorType &faces, const IndexGroupType &bucket,
+                                const FaceTypedBase *object, std::vector<IndexGroupType> &groupsOut);
         std::vector<FaceVectorType> equalityVector;
     };
 
@@ -213,7 +222,7 @@ private:
 protected:
     TopTools_DataMapOfShapeListOfShape myModified;
     TopTools_ListOfShape myEmptyList;
-    TopTools_ListOfShape myDeleted;
+    TopTools_MapOfShape myDeleted;
 };
 }
 
@@ -32,11 +32,15 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <future>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <sstream>
+#include <tuple>
 #include <vector>
 
 // Qt
@@ -48,6 +52,7 @@
 #include <boost/algorithm/string/regex.hpp>
 #include <boost/format.hpp>
 #include <boost/geometry/geometries/register/point.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #include <boost/iostreams/device/array.hpp>
 #include <boost/iostreams/stream.hpp>
 #include <boost/random.hpp>
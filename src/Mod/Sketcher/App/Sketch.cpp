@@ -5263,9 +5263,59 @@ int Sketch::movePoint(int geoId, PointPos pos, Base::Vector3d toPoint, bool rela
     return solve();
 }
 
-int Sketch::setDatum(int /*constrId*/, double /*value*/)
+bool Sketch::updateDatum(const std::vector<Constraint*>& ConstraintList,
+                         int constrId,
+                         Constraint* newConstraint,
+                         int geoCount)
 {
-    return -1;
+    if (isInitMove || int(Geoms.size()) != geoCount || constrId < 0
+        || constrId >= int(ConstraintList.size())) {
+        return false;
+    }
+
+    // Make sure the solver system was set up from this very constraint list. Inactive and
+    // unenforceable constraints are not part of the system, so Constrs is a subsequence of it.
+    ConstrDef* def = nullptr;
+    auto it = Constrs.begin();
+    for (int i = 0; i < int(ConstraintList.size()); ++i) {
+        auto constr = ConstraintList[i];
+        if (constr->Type == Block) {
+            // block constraints fix parameters depending on the diagnosis, set up again
+            return false;
+        }
+        if (it != Constrs.end() && it->constr == constr) {
+            if (i == constrId) {
+                def = &(*it);
+            }
+            ++it;
+        }
+    }
+    if (it != Constrs.end() || !def || !def->driving || !def->value || def->secondvalue) {
+        return false;
+    }
+
+    // only the constraints whose solver parameter is the plain datum value
+    switch (def->constr->Type) {
+        case DistanceX:
+        case DistanceY:
+        case Distance:
+        case Radius:
+        case Diameter:
+        case Weight:
+            break;
+        case Angle:
+            // the angle at point constraint stores an offset datum
+            if (def->constr->Third == GeoEnum::GeoUndef) {
+                break;
+            }
+            return false;
+        default:
+            return false;
+    }
+
+    def->constr = newConstraint;
+    *def->value = newConstraint->getValue();
+    return true;
 }
 
 int Sketch::getPointId(int geoId, PointPos pos) const
@@ -153,10 +153,26 @@ public:
 
 
 public:
-    /** set the datum of a distance or angle constraint to a certain value and solve
-     * This can cause the solving to fail!
+    /** update the datum of a driving dimensional constraint in the existing solver system
+     *
+     * The datum enters the solver system only as a fixed parameter, so changing it does not
+     * require the system to be set up again. The parameters of the last solution are kept as
+     * the starting point of the next solve().
+     *
+     * @param ConstraintList: the constraint list the sketch was set up with
+     * @param constrId: index of the changed constraint in ConstraintList
+     * @param newConstraint: the constraint carrying the new datum, it replaces
+     * ConstraintList[constrId] in the solver
+     * @param geoCount: the number of geometries (including external) of the sketch
+     *
+     * returns false, without changing anything, if the sketch was not set up from
+     * ConstraintList or the constraint can't be updated in place. setUpSketch() must be
+     * called in this case.
      */
-    int setDatum(int constrId, double value);
+    bool updateDatum(const std::vector<Constraint*>& ConstraintList,
+                     int constrId,
+                     Constraint* newConstraint,
+                     int geoCount);
 
     /** initializes a point (or curve) drag by setting the current
      * sketch status as a reference
@@ -23,7 +23,10 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <cmath>
+#include <map>
+#include <tuple>
 
 #include <BRep_Tool.hxx>
 #include <Precision.hxx>
@@ -33,10 +36,13 @@
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <gp_Pnt.hxx>
+#include <boost_geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #endif
 
 #include <App/Document.h>
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 
 #include "GeometryFacade.h"
 #include "SketchAnalysis.h"
@@ -62,25 +68,11 @@ struct VertexIds
 
 struct Vertex_Less
 {
-    explicit Vertex_Less(double tolerance)
-        : tolerance(tolerance)
-    {}
     bool operator()(const VertexIds& x, const VertexIds& y) const
     {
-        if (fabs(x.v.x - y.v.x) > tolerance) {
-            return x.v.x < y.v.x;
-        }
-        if (fabs(x.v.y - y.v.y) > tolerance) {
-            return x.v.y < y.v.y;
-        }
-        if (fabs(x.v.z - y.v.z) > tolerance) {
-            return x.v.z < y.v.z;
-        }
-        return false;  // points are considered to be equal
+        return std::tie(x.v.x, x.v.y, x.v.z, x.GeoId, x.PosId)
+            < std::tie(y.v.x, y.v.y, y.v.z, y.GeoId, y.PosId);
     }
-
-private:
-    double tolerance;
 };
 
 struct VertexID_Less
@@ -120,19 +112,10 @@ struct EdgeIds
 
 struct Edge_Less
 {
-    explicit Edge_Less(double tolerance)
-        : tolerance(tolerance)
-    {}
     bool operator()(const EdgeIds& x, const EdgeIds& y) const
     {
-        if (fabs(x.l - y.l) > tolerance) {
-            return x.l < y.l;
-        }
-        return false;  // points are considered to be equal
+        return x.l < y.l || (x.l == y.l && x.GeoId < y.GeoId);
     }
-
-private:
-    double tolerance;
 };
 
 struct Edge_EqualTo
@@ -256,129 +239,211 @@ struct PointConstraints
     {
         std::list<ConstraintIds> missingCoincidences;  // Holds the list of missing coincidences
 
-        // Sort points in geographic order
-        std::sort(vertexIds.begin(), vertexIds.end(), Vertex_Less(precision));
+        // Groups of vertices within precision of the first vertex of the group
+        std::vector<std::vector<int>> groups = getAdjacentGroups(precision);
 
-        auto vt = vertexIds.begin();
-        Vertex_EqualTo pred(precision);
+        // Distribute the existing constraints to the groups of the vertices they refer to, keeping
+        // their order. Constraints not referring to a vertex of a group do not change it.
+        std::map<VertexIds, int, VertexID_Less> vertexGroup;
+        for (std::size_t i = 0; i < groups.size(); ++i) {
+            for (int vertex : groups[i]) {
+                vertexGroup[vertexIds[vertex]] = int(i);
+            }
+        }
+        std::vector<std::vector<Sketcher::Constraint*>> groupConstraints(groups.size());
+        for (auto& coincidence : allcoincid) {
+            VertexIds v1;
+            VertexIds v2;
+            v1.GeoId = coincidence->First;
+            v1.PosId = coincidence->FirstPos;
+            v2.GeoId = coincidence->Second;
+            v2.PosId = coincidence->SecondPos;
+            auto it1 = vertexGroup.find(v1);
+            auto it2 = vertexGroup.find(v2);
+            if (it1 != vertexGroup.end()) {
+                groupConstraints[it1->second].push_back(coincidence);
+            }
+            if (it2 != vertexGroup.end() && (it1 == vertexGroup.end() || it1->second != it2->second)) {
+                groupConstraints[it2->second].push_back(coincidence);
+            }
+        }
 
-        // Comparing existing constraints and find missing ones
-
-        while (vt < vertexIds.end()) {
-            // Seeking for adjacent group of vertices
-            vt = std::adjacent_find(vt, vertexIds.end(), pred);
-            if (vt < vertexIds.end()) {  // If one found
-                std::vector<VertexIds>::iterator vn;
-                // Holds a single group of adjacent vertices
-                std::set<VertexIds, VertexID_Less> vertexGrp;
-                // Extract the group of adjacent vertices
-                vertexGrp.insert(*vt);
-                for (vn = vt + 1; vn < vertexIds.end(); ++vn) {
-                    if (pred(*vt, *vn)) {
-                        vertexGrp.insert(*vn);
-                    }
-                    else {
-                        break;
-                    }
-                }
+        // The groups are independent, so they are checked in parallel. The results are
+        // collected in the order of the groups.
+        std::vector<std::vector<ConstraintIds>> groupResults(groups.size());
+        const std::size_t minGroupsPerThread = 256;
+        Base::parallelFor(
+            groups.size(),
+            [&](std::size_t i) {
+                groupResults[i] = getMissingCoincidences(groups[i], groupConstraints[i]);
+            },
+            std::min(Base::parallelThreadCount(), groups.size() / minGroupsPerThread + 1));
+
+        for (auto& result : groupResults) {
+            missingCoincidences.insert(missingCoincidences.end(), result.begin(), result.end());
+        }
 
-                // Holds groups of coincident vertices
-                std::vector<std::set<VertexIds, VertexID_Less>> coincVertexGrps;
-
-                // Decompose the group of adjacent vertices into groups of coincident vertices
-                // Going through existent coincidences
-                for (auto& coincidence : allcoincid) {
-                    VertexIds v1;
-                    VertexIds v2;
-                    v1.GeoId = coincidence->First;
-                    v1.PosId = coincidence->FirstPos;
-                    v2.GeoId = coincidence->Second;
-                    v2.PosId = coincidence->SecondPos;
-
-                    // Look if coincident vertices are in the group of adjacent ones we are
-                    // processing
-                    auto nv1 = vertexGrp.extract(v1);
-                    auto nv2 = vertexGrp.extract(v2);
-
-                    // Maybe if both empty, they already have been extracted by other coincidences
-                    // We have to check in existing coincident groups and eventually merge
-                    if (nv1.empty() && nv2.empty()) {
-                        std::set<VertexIds, VertexID_Less>* tempGrp = nullptr;
-                        for (auto it = coincVertexGrps.begin(); it < coincVertexGrps.end(); ++it) {
-                            if ((it->find(v1) != it->end()) || (it->find(v2) != it->end())) {
-                                if (!tempGrp) {
-                                    tempGrp = &*it;
-                                }
-                                else {
-                                    tempGrp->insert(it->begin(), it->end());
-                                    coincVertexGrps.erase(it);
-                                    break;
-                                }
-                            }
-                        }
-                        continue;
-                    }
+        return missingCoincidences;
+    }
 
-                    // Look if one of the constrained vertices is already in a group of coincident
-                    // vertices
-                    for (std::set<VertexIds, VertexID_Less>& grp : coincVertexGrps) {
-                        if ((grp.find(v1) != grp.end()) || (grp.find(v2) != grp.end())) {
-                            // If yes add them to the existing group
-                            if (!nv1.empty()) {
-                                grp.insert(nv1.value());
-                            }
-                            if (!nv2.empty()) {
-                                grp.insert(nv2.value());
-                            }
-                            continue;
-                        }
-                    }
+private:
+    using RPoint = boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian>;
+    using RBox = boost::geometry::model::box<RPoint>;
+    using RValue = std::pair<RPoint, int>;
 
-                    if (nv1.empty() || nv2.empty()) {
-                        continue;
-                    }
+    // Returns the groups of at least two vertices within precision of the first vertex of the
+    // group. The vertices are sorted geometrically, a group and the groups are in this order.
+    std::vector<std::vector<int>> getAdjacentGroups(double precision)
+    {
+        std::sort(vertexIds.begin(), vertexIds.end(), Vertex_Less());
+
+        std::vector<RValue> values;
+        values.reserve(vertexIds.size());
+        for (std::size_t i = 0; i < vertexIds.size(); ++i) {
+            values.emplace_back(RPoint(vertexIds[i].v.x, vertexIds[i].v.y), int(i));
+        }
+        // the packing constructor builds a balanced tree in one go
+        boost::geometry::index::rtree<RValue, boost::geometry::index::quadratic<16>> rtree(values);
 
-                    // If no, create a new group of coincident vertices
-                    std::set<VertexIds, VertexID_Less> newGrp;
-                    newGrp.insert(nv1.value());
-                    newGrp.insert(nv2.value());
-                    coincVertexGrps.push_back(newGrp);
+        Vertex_EqualTo pred(precision);
+        std::vector<std::vector<int>> groups;
+        std::vector<bool> grouped(vertexIds.size(), false);
+        std::vector<RValue> found;
+        for (std::size_t i = 0; i < vertexIds.size(); ++i) {
+            if (grouped[i]) {
+                continue;
+            }
+            const Base::Vector3d& v = vertexIds[i].v;
+            RBox box(RPoint(v.x - precision, v.y - precision),
+                     RPoint(v.x + precision, v.y + precision));
+            found.clear();
+            rtree.query(boost::geometry::index::intersects(box), std::back_inserter(found));
+
+            std::vector<int> group {int(i)};
+            for (const auto& value : found) {
+                int j = value.second;
+                if (j != int(i) && !grouped[j] && pred(vertexIds[i], vertexIds[j])) {
+                    group.push_back(j);
                 }
+            }
+            if (group.size() < 2) {
+                continue;
+            }
+            std::sort(group.begin(), group.end());
+            for (int j : group) {
+                grouped[j] = true;
+            }
+            groups.push_back(std::move(group));
+        }
+        return groups;
+    }
 
-                // If there are remaining vertices in the adjacent group (not in any existing
-                // constraint) add them as being each a separate coincident group
-                for (auto& lonept : vertexGrp) {
-                    std::set<VertexIds, VertexID_Less> newGrp;
-                    newGrp.insert(lonept);
-                    coincVertexGrps.push_back(newGrp);
+    // Decomposes a group of adjacent vertices into groups of coincident vertices according to the
+    // existing constraints and returns the constraints missing between these groups
+    std::vector<ConstraintIds>
+    getMissingCoincidences(const std::vector<int>& group,
+                           const std::vector<Sketcher::Constraint*>& allcoincid) const
+    {
+        std::vector<ConstraintIds> missingCoincidences;
+
+        // Holds a single group of adjacent vertices
+        std::set<VertexIds, VertexID_Less> vertexGrp;
+        for (int vertex : group) {
+            vertexGrp.insert(vertexIds[vertex]);
+        }
+
+        // Holds groups of coincident vertices
+        std::vector<std::set<VertexIds, VertexID_Less>> coincVertexGrps;
+
+        // Decompose the group of adjacent vertices into groups of coincident vertices
+        // Going through existent coincidences
+        for (auto& coincidence : allcoincid) {
+            VertexIds v1;
+            VertexIds v2;
+            v1.GeoId = coincidence->First;
+            v1.PosId = coincidence->FirstPos;
+            v2.GeoId = coincidence->Second;
+            v2.PosId = coincidence->SecondPos;
+
+            // Look if coincident vertices are in the group of adjacent ones we are
+            // processing
+            auto nv1 = vertexGrp.extract(v1);
+            auto nv2 = vertexGrp.extract(v2);
+
+            // Maybe if both empty, they already have been extracted by other coincidences
+            // We have to check in existing coincident groups and eventually merge
+            if (nv1.empty() && nv2.empty()) {
+                std::set<VertexIds, VertexID_Less>* tempGrp = nullptr;
+                for (auto it = coincVertexGrps.begin(); it < coincVertexGrps.end(); ++it) {
+                    if ((it->find(v1) != it->end()) || (it->find(v2) != it->end())) {
+                        if (!tempGrp) {
+                            tempGrp = &*it;
+                        }
+                        else {
+                            tempGrp->insert(it->begin(), it->end());
+                            coincVertexGrps.erase(it);
+                            break;
+                        }
+                    }
                 }
+                continue;
+            }
 
-                // If there is more than 1 coincident group into adjacent group, constraint(s)
-                // is(are) missing Virtually generate the missing constraint(s)
-                if (coincVertexGrps.size() > 1) {
-                    std::vector<std::set<VertexIds, VertexID_Less>>::iterator vn;
-                    // Starting from the 2nd coincident group, generate a constraint between
-                    // this group first vertex, and previous group first vertex
-                    for (vn = coincVertexGrps.begin() + 1; vn < coincVertexGrps.end(); ++vn) {
-                        ConstraintIds id;
-                        id.Type = Coincident;  // default point on point restriction
-                        id.v = (vn - 1)->begin()->v;
-                        id.First = (vn - 1)->begin()->GeoId;
-                        id.FirstPos = (vn - 1)->begin()->PosId;
-                        id.Second = vn->begin()->GeoId;
-                        id.SecondPos = vn->begin()->PosId;
-                        missingCoincidences.push_back(id);
+            // Look if one of the constrained vertices is already in a group of coincident
+            // vertices
+            for (std::set<VertexIds, VertexID_Less>& grp : coincVertexGrps) {
+                if ((grp.find(v1) != grp.end()) || (grp.find(v2) != grp.end())) {
+                    // If yes add them to the existing group
+                    if (!nv1.empty()) {
+                        grp.insert(nv1.value());
                     }
+                    if (!nv2.empty()) {
+                        grp.insert(nv2.value());
+                    }
+                    continue;
                 }
+            }
 
-                vt = vn;
+            if (nv1.empty() || nv2.empty()) {
+                continue;
+            }
+
+            // If no, create a new group of coincident vertices
+            std::set<VertexIds, VertexID_Less> newGrp;
+            newGrp.insert(nv1.value());
+            newGrp.insert(nv2.value());
+            coincVertexGrps.push_back(newGrp);
+        }
+
+        // If there are remaining vertices in the adjacent group (not in any existing
+        // constraint) add them as being each a separate coincident group
+        for (auto& lonept : vertexGrp) {
+            std::set<VertexIds, VertexID_Less> newGrp;
+            newGrp.insert(lonept);
+            coincVertexGrps.push_back(newGrp);
+        }
+
+        // If there is more than 1 coincident group into adjacent group, constraint(s)
+        // is(are) missing Virtually generate the missing constraint(s)
+        if (coincVertexGrps.size() > 1) {
+            std::vector<std::set<VertexIds, VertexID_Less>>::iterator vn;
+            // Starting from the 2nd coincident group, generate a constraint between
+            // this group first vertex, and previous group first vertex
+            for (vn = coincVertexGrps.begin() + 1; vn < coincVertexGrps.end(); ++vn) {
+                ConstraintIds id;
+                id.Type = Coincident;  // default point on point restriction
+                id.v = (vn - 1)->begin()->v;
+                id.First = (vn - 1)->begin()->GeoId;
+                id.FirstPos = (vn - 1)->begin()->PosId;
+                id.Second = vn->begin()->GeoId;
+                id.SecondPos = vn->begin()->PosId;
+                missingCoincidences.push_back(id);
             }
         }
 
         return missingCoincidences;
     }
 
-private:
     // Holds a list of all vertices in the sketch
     std::vector<VertexIds> vertexIds;
 };
@@ -424,7 +489,7 @@ struct EqualityConstraints
 
     std::list<ConstraintIds> getEqualLines(double precision)
     {
-        std::sort(lineedgeIds.begin(), lineedgeIds.end(), Edge_Less(precision));
+        std::sort(lineedgeIds.begin(), lineedgeIds.end(), Edge_Less());
         auto vt = lineedgeIds.begin();
         Edge_EqualTo pred(precision);
 
@@ -460,7 +525,7 @@ struct EqualityConstraints
 
     std::list<ConstraintIds> getEqualRadius(double precision)
     {
-        std::sort(radiusedgeIds.begin(), radiusedgeIds.end(), Edge_Less(precision));
+        std::sort(radiusedgeIds.begin(), radiusedgeIds.end(), Edge_Less());
         auto vt = radiusedgeIds.begin();
         Edge_EqualTo pred(precision);
 
@@ -747,31 +812,41 @@ int SketchAnalysis::detectMissingEqualityConstraints(double precision)
     std::list<ConstraintIds> equallines = equalConstr.getEqualLines(precision);
     std::list<ConstraintIds> equalradius = equalConstr.getEqualRadius(precision);
 
-    // Go through the available 'Coincident', 'Tangent' or 'Perpendicular' constraints
-    // and check which of them is forcing two vertexes to be coincident.
-    // If there is none but two vertexes can be considered equal a coincident constraint is missing.
-    std::vector<Sketcher::Constraint*> constraint = sketch->Constraints.getValues();
-    for (auto it : constraint) {
+    // Go through the available 'Equal' constraints and drop the detected equalities they already
+    // cover. Each existing constraint covers the first matching detected one, in either
+    // direction, so they are counted per pair of edges.
+    using EdgePair =
+        std::pair<std::pair<int, Sketcher::PointPos>, std::pair<int, Sketcher::PointPos>>;
+    auto edgePair = [](int first,
+                       Sketcher::PointPos firstPos,
+                       int second,
+                       Sketcher::PointPos secondPos) {
+        auto a = std::make_pair(first, firstPos);
+        auto b = std::make_pair(second, secondPos);
+        return a < b ? EdgePair(a, b) : EdgePair(b, a);
+    };
+    std::map<EdgePair, int> existingEqualities;
+    for (auto it : sketch->Constraints.getValues()) {
         if (it->Type == Sketcher::Equal) {
-            ConstraintIds id {Base::Vector3d {},
-                              it->First,
-                              it->Second,
-                              it->FirstPos,
-                              it->SecondPos,
-                              it->Type};
-
-            auto pos = std::find_if(equallines.begin(), equallines.end(), Constraint_Equal(id));
-
-            if (pos != equallines.end()) {
-                equallines.erase(pos);
+            ++existingEqualities[edgePair(it->First, it->FirstPos, it->Second, it->SecondPos)];
+        }
+    }
+    auto removeExisting = [&](std::list<ConstraintIds>& ids) {
+        std::map<EdgePair, int> counts = existingEqualities;
+        for (auto it = ids.begin(); it != ids.end();) {
+            auto count = counts.find(edgePair(it->First, it->FirstPos, it->Second, it->SecondPos));
+            if (count != counts.end() && count->second > 0) {
+                --count->second;
+                it = ids.erase(it);
             }
-
-            pos = std::find_if(equalradius.begin(), equalradius.end(), Constraint_Equal(id));
-
-            if (pos != equalradius.end()) {
-                equalradius.erase(pos);
+            else {
+                ++it;
             }
         }
+    };
+    if (!existingEqualities.empty()) {
+        removeExisting(equallines);
+        removeExisting(equalradius);
     }
 
     this->lineequalityConstraints.clear();
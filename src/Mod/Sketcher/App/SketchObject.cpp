@@ -532,6 +532,11 @@ int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
 
     retrieveSolverDiagnostics();
 
+    return solveSketch(updateGeoAfterSolving);
+}
+
+int SketchObject::solveSketch(bool updateGeoAfterSolving)
+{
     lastSolveTime = 0.0;
 
     // Failure is default for notifying the user unless otherwise proven
@@ -841,9 +846,26 @@ int SketchObject::setDatum(int ConstrId, double Datum)
     newVals[ConstrId] = newVals[ConstrId]->clone();
     newVals[ConstrId]->setValue(Datum);
 
+    // A datum change does not alter the structure of the solver system. If the last set up is
+    // still current and was healthy, just update the datum in it and solve starting from the
+    // last solution, instead of setting up the whole sketch again.
+    bool updatedInPlace = !solverNeedsUpdate && lastDoF >= 0 && !lastHasConflict
+        && !lastHasRedundancies && !lastHasPartialRedundancies && !lastHasMalformedConstraints
+        && solvedSketch.updateDatum(vals,
+                                    ConstrId,
+                                    newVals[ConstrId],
+                                    Geometry.getSize() + getExternalGeometryCount());
+
     this->Constraints.setValues(std::move(newVals));
 
-    int err = solve();
+    int err = -1;
+    if (updatedInPlace) {
+        err = solveSketch(true);
+    }
+    if (err) {
+        // fall back to a full set up for the proper diagnosis
+        err = solve();
+    }
 
     if (err)
         this->Constraints.getValues()[ConstrId]->setValue(oldDatum);// newVals is a shell now
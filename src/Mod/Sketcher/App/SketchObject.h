@@ -941,6 +941,9 @@ protected:
     // retrieves redundant, conflicting and malformed constraint information from the solver
     void retrieveSolverDiagnostics();
 
+    /// solve the already set up solver sketch, see solve() for the return codes
+    int solveSketch(bool updateGeoAfterSolving);
+
     // retrieves whether a geometry blocked state corresponds to this constraint
     // returns true of the constraint is of Block type, false otherwise
     bool getBlockedState(const Constraint* cstr, bool& blockedstate) const;
@@ -93,6 +93,17 @@ double Constraint::grad(double* /*param*/)
     return 0.0;
 }
 
+void Constraint::gradients(VEC_D& derivs)
+{
+    derivs.assign(pvec.size(), 0.);
+    for (std::size_t i = 0; i < pvec.size(); i++) {
+        // grad() already accounts for all the entries of a parameter
+        if (findParamInPvec(pvec[i]) == static_cast<int>(i)) {
+            derivs[i] = grad(pvec[i]);
+        }
+    }
+}
+
 double Constraint::maxStep(MAP_pD_D& /*dir*/, double lim)
 {
     return lim;
@@ -691,6 +702,11 @@ double ConstraintDifference::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintDifference::gradients(VEC_D& derivs)
+{
+    derivs.assign({-scale, scale, -scale});
+}
+
 
 // --------------------------------------------------------
 // P2PDistance
@@ -751,6 +767,14 @@ double ConstraintP2PDistance::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2PDistance::gradients(VEC_D& derivs)
+{
+    double dx = (*p1x() - *p2x());
+    double dy = (*p1y() - *p2y());
+    double d = sqrt(dx * dx + dy * dy);
+    derivs.assign({scale * dx / d, scale * dy / d, -scale * dx / d, -scale * dy / d, -scale});
+}
+
 double ConstraintP2PDistance::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it;
@@ -862,6 +886,25 @@ double ConstraintP2PAngle::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2PAngle::gradients(VEC_D& derivs)
+{
+    double dx = (*p2x() - *p1x());
+    double dy = (*p2y() - *p1y());
+    double a = *angle() + da;
+    double ca = cos(a);
+    double sa = sin(a);
+    double x = dx * ca + dy * sa;
+    double y = -dx * sa + dy * ca;
+    double r2 = dx * dx + dy * dy;
+    dx = -y / r2;
+    dy = x / r2;
+    derivs.assign({scale * (-ca * dx + sa * dy),
+                   scale * (-sa * dx - ca * dy),
+                   scale * (ca * dx - sa * dy),
+                   scale * (sa * dx + ca * dy),
+                   -scale});
+}
+
 double ConstraintP2PAngle::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it = dir.find(angle());
@@ -954,6 +997,25 @@ double ConstraintP2LDistance::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2LDistance::gradients(VEC_D& derivs)
+{
+    double x0 = *p0x(), x1 = *p1x(), x2 = *p2x();
+    double y0 = *p0y(), y1 = *p1y(), y2 = *p2y();
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double d2 = dx * dx + dy * dy;
+    double d = sqrt(d2);
+    double area = -x0 * dy + y0 * dx + x1 * y2 - x2 * y1;
+    double sign = area < 0 ? -scale : scale;
+    derivs.assign({sign * (y1 - y2) / d,
+                   sign * (x2 - x1) / d,
+                   sign * ((y2 - y0) * d + (dx / d) * area) / d2,
+                   sign * ((x0 - x2) * d + (dy / d) * area) / d2,
+                   sign * ((y0 - y1) * d - (dx / d) * area) / d2,
+                   sign * ((x1 - x0) * d - (dy / d) * area) / d2,
+                   -scale});
+}
+
 double ConstraintP2LDistance::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it;
@@ -1089,6 +1151,23 @@ double ConstraintPointOnLine::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintPointOnLine::gradients(VEC_D& derivs)
+{
+    double x0 = *p0x(), x1 = *p1x(), x2 = *p2x();
+    double y0 = *p0y(), y1 = *p1y(), y2 = *p2y();
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double d2 = dx * dx + dy * dy;
+    double d = sqrt(d2);
+    double area = -x0 * dy + y0 * dx + x1 * y2 - x2 * y1;
+    derivs.assign({scale * (y1 - y2) / d,
+                   scale * (x2 - x1) / d,
+                   scale * ((y2 - y0) * d + (dx / d) * area) / d2,
+                   scale * ((x0 - x2) * d + (dy / d) * area) / d2,
+                   scale * ((y0 - y1) * d - (dx / d) * area) / d2,
+                   scale * ((x1 - x0) * d - (dy / d) * area) / d2});
+}
+
 
 // --------------------------------------------------------
 // PointOnPerpBisector
@@ -1242,6 +1321,22 @@ double ConstraintParallel::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintParallel::gradients(VEC_D& derivs)
+{
+    double dx1 = (*l1p1x() - *l1p2x());
+    double dy1 = (*l1p1y() - *l1p2y());
+    double dx2 = (*l2p1x() - *l2p2x());
+    double dy2 = (*l2p1y() - *l2p2y());
+    derivs.assign({scale * dy2,
+                   -scale * dx2,
+                   -scale * dy2,
+                   scale * dx2,
+                   -scale * dy1,
+                   scale * dx1,
+                   scale * dy1,
+                   -scale * dx1});
+}
+
 
 // --------------------------------------------------------
 // Perpendicular
@@ -1328,6 +1423,22 @@ double ConstraintPerpendicular::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintPerpendicular::gradients(VEC_D& derivs)
+{
+    double dx1 = (*l1p1x() - *l1p2x());
+    double dy1 = (*l1p1y() - *l1p2y());
+    double dx2 = (*l2p1x() - *l2p2x());
+    double dy2 = (*l2p1y() - *l2p2y());
+    derivs.assign({scale * dx2,
+                   scale * dy2,
+                   -scale * dx2,
+                   -scale * dy2,
+                   scale * dx1,
+                   scale * dy1,
+                   -scale * dx1,
+                   -scale * dy1});
+}
+
 
 // --------------------------------------------------------
 // L2LAngle
@@ -1442,6 +1553,32 @@ double ConstraintL2LAngle::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintL2LAngle::gradients(VEC_D& derivs)
+{
+    double dx1 = (*l1p2x() - *l1p1x());
+    double dy1 = (*l1p2y() - *l1p1y());
+    double r1 = dx1 * dx1 + dy1 * dy1;
+    double dx2 = (*l2p2x() - *l2p1x());
+    double dy2 = (*l2p2y() - *l2p1y());
+    double a = atan2(dy1, dx1) + *angle();
+    double ca = cos(a);
+    double sa = sin(a);
+    double x2 = dx2 * ca + dy2 * sa;
+    double y2 = -dx2 * sa + dy2 * ca;
+    double r2 = dx2 * dx2 + dy2 * dy2;
+    dx2 = -y2 / r2;
+    dy2 = x2 / r2;
+    derivs.assign({-scale * dy1 / r1,
+                   scale * dx1 / r1,
+                   scale * dy1 / r1,
+                   -scale * dx1 / r1,
+                   scale * (-ca * dx2 + sa * dy2),
+                   scale * (-sa * dx2 - ca * dy2),
+                   scale * (ca * dx2 - sa * dy2),
+                   scale * (sa * dx2 + ca * dy2),
+                   -scale});
+}
+
 double ConstraintL2LAngle::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it = dir.find(angle());
@@ -133,7 +133,7 @@ public:
     virtual ~Constraint()
     {}
 
-    inline VEC_pD params()
+    inline const VEC_pD& params() const
     {
         return pvec;
     }
@@ -171,7 +171,10 @@ public:
     virtual void rescale(double coef = 1.);
     virtual double error();
     virtual double grad(double*);
-    // virtual void grad(MAP_pD_D &deriv);  --> TODO: vectorized grad version
+    // Computes the derivatives with respect to all the entries of pvec in a single call, derivs[i]
+    // being the derivative with respect to pvec[i]. If a parameter appears several times in pvec,
+    // the derivatives of its entries add up to the derivative with respect to that parameter.
+    virtual void gradients(VEC_D& derivs);
     virtual double maxStep(MAP_pD_D& dir, double lim = 1.);
     // Finds first occurrence of param in pvec. This is useful to test if a constraint depends
     // on the parameter (it may not actually depend on it, e.g. angle-via-point doesn't depend
@@ -380,6 +383,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradients(VEC_D& derivs) override;
 };
 
 // P2PDistance
@@ -417,6 +421,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradients(VEC_D& derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
 };
 
@@ -456,6 +461,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradients(VEC_D& derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
 };
 
@@ -502,6 +508,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradients(VEC_D& derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
     double abs(double darea);
 };
@@ -546,6 +553,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradients(VEC_D& derivs) override;
 };
 
 // PointOnPerpBisector
@@ -638,6 +646,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradients(VEC_D& derivs) override;
 };
 
 // Perpendicular
@@ -688,6 +697,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradients(VEC_D& derivs) override;
 };
 
 // L2LAngle
@@ -742,6 +752,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void gradients(VEC_D& derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
 };
 
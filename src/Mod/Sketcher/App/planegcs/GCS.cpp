@@ -48,13 +48,21 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <future>
 #include <iostream>
 #include <limits>
+#include <numeric>
+#include <unordered_set>
 
 #include "GCS.h"
 #include "qp_eq.h"
 
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseLU>
+
 // NOTE: In CMakeList.txt -DEIGEN_NO_DEBUG is set (it does not work with a define here), to solve
 // this: this is needed to fix this SparseQR crash
 // https://forum.freecad.org/viewtopic.php?f=10&t=11341&p=92146#p92146, until Eigen library fixes
@@ -96,6 +104,7 @@
 #endif
 
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 #include <FCConfig.h>
 
 #include <boost/graph/connected_components.hpp>
@@ -478,6 +487,9 @@ System::System()
     , convergence(1e-10)
     , convergenceRedundant(1e-10)
     , qrAlgorithm(EigenSparseQR)
+    , blockDiagnosis(true)
+    , parallelSubsystems(true)
+    , sparseJacobianThreshold(100)
     , dogLegGaussStep(FullPivLU)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
@@ -1981,26 +1993,90 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
         return Failed;
     }
 
-    bool isReset = false;
-    // return success by default in order to permit coincidence constraints to be applied
-    // even if no other system has to be solved
-    int res = Success;
+    // the decoupled subsystems share no parameters, so they can be solved in any order
+    std::vector<int> cids;
+    std::size_t paramsNum = 0;
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
-        if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
-            resetToReference();
-            isReset = true;
+        if (subSystems[cid] || subSystemsAux[cid]) {
+            cids.push_back(cid);
+            paramsNum += plists[cid].size();
         }
+    }
+    if (!cids.empty()) {
+        resetToReference();
+    }
+
+    std::vector<int> results(subSystems.size(), Success);
+    std::vector<double> times(subSystems.size(), 0.0);
+    auto solveSubsystem = [&](int cid) {
+        auto start = std::chrono::steady_clock::now();
         if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res,
-                           solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+            results[cid] = solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
         }
         else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+            results[cid] = solve(subSystems[cid], isFine, alg, isRedundantsolving);
+        }
+        else {
+            results[cid] = solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
+        }
+        times[cid] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    // Solvers log every iteration to the console at IterationLevel, which is not thread safe.
+    // Small systems are solved faster than the threads can be started.
+    bool parallel = parallelSubsystems && debugMode != IterationLevel && cids.size() > 1
+        && paramsNum >= 64;
+#ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
+    parallel = false;
+#endif
+    std::size_t threads = parallel ? std::min(Base::parallelThreadCount(), cids.size()) : 1;
+    if (threads > 1) {
+        // biggest subsystems first for a better balance between the threads
+        std::stable_sort(cids.begin(), cids.end(), [this](int a, int b) {
+            return plists[a].size() > plists[b].size();
+        });
+    }
+    Base::parallelFor(
+        cids.size(),
+        [&cids, &solveSubsystem](std::size_t i) {
+            solveSubsystem(cids[i]);
+        },
+        threads);
+
+    // return success by default in order to permit coincidence constraints to be applied
+    // even if no other system has to be solved
+    int res = Success;
+    for (int cid = 0; cid < int(subSystems.size()); cid++) {
+        res = std::max(res, results[cid]);
+    }
+
+    // the breakdown per subsystem is only listed at IterationLevel, the slowest one otherwise
+    if ((debugMode == Minimal || debugMode == IterationLevel) && cids.size() > 1) {
+        std::stringstream stream;
+        stream << "GCS::System::solve: " << cids.size() << " subsystems on " << threads
+               << " thread(s)\n";
+        int slowest = cids.front();
+        for (int cid = 0; cid < int(subSystems.size()); cid++) {
+            if (!subSystems[cid] && !subSystemsAux[cid]) {
+                continue;
+            }
+            if (times[cid] > times[slowest]) {
+                slowest = cid;
+            }
+            if (debugMode == IterationLevel) {
+                stream << "  subsystem " << cid << ": " << plists[cid].size() << " params, "
+                       << clists[cid].size() << " constraints, result " << results[cid] << ", "
+                       << times[cid] * 1000.0 << " ms\n";
+            }
         }
-        else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+        if (debugMode == Minimal) {
+            stream << "  slowest subsystem " << slowest << ": " << plists[slowest].size()
+                   << " params, " << clists[slowest].size() << " constraints, "
+                   << times[slowest] * 1000.0 << " ms\n";
         }
+        SolverReportingManager::Manager().LogString(stream.str());
     }
+
     if (res == Success) {
         for (std::set<Constraint*>::const_iterator constr = redundant.begin();
              constr != redundant.end();
@@ -2158,7 +2234,114 @@ int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolvi
     return Failed;
 }
 
+namespace
+{
+
+// Solves the augmented normal equations (A + mu I) h = g of LM. Returns false if the solution is
+// not accurate enough.
+bool solveAugmented(const Eigen::MatrixXd& A,
+                    double mu,
+                    const Eigen::VectorXd& g,
+                    Eigen::VectorXd& h)
+{
+    Eigen::MatrixXd Aaug = A;
+    Aaug.diagonal().array() += mu;
+    h = Aaug.fullPivLu().solve(g);
+    double rel_error = (Aaug * h - g).norm() / g.norm();
+    return rel_error < 1e-5;
+}
+
+bool solveAugmented(const Eigen::SparseMatrix<double>& A,
+                    double mu,
+                    const Eigen::VectorXd& g,
+                    Eigen::VectorXd& h)
+{
+    Eigen::SparseMatrix<double> identity(A.rows(), A.cols());
+    identity.setIdentity();
+    // for mu > 0 the augmented matrix is positive definite
+    Eigen::SparseMatrix<double> Aaug = A + mu * identity;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(Aaug);
+    if (ldlt.info() != Eigen::Success) {
+        return false;
+    }
+    h = ldlt.solve(g);
+    double rel_error = (Aaug * h - g).norm() / g.norm();
+    return rel_error < 1e-5;
+}
+
+// Gauss-Newton step of DogLeg, solving Jx h_gn = -fx
+// https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
+// https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+void gaussNewtonStep(const Eigen::MatrixXd& Jx,
+                     const Eigen::VectorXd& fx,
+                     DogLegGaussStep dogLegGaussStep,
+                     Eigen::VectorXd& h_gn)
+{
+    switch (dogLegGaussStep) {
+        case FullPivLU:
+            h_gn = Jx.fullPivLu().solve(-fx);
+            break;
+        case LeastNormFullPivLU:
+            h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
+            break;
+        case LeastNormLdlt:
+            h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
+            break;
+    }
+}
+
+// A sparse LU of a square, regular Jx gives the unique solution like FullPivLU, a sparse LDLT of
+// Jx Jx^T gives the least norm solution. A non-square Jx has no unique basic solution, any other
+// decomposition than FullPivLU would move the sketch differently, so the dense decomposition is
+// used for it and whenever the sparse one fails to solve the system.
+void gaussNewtonStep(const Eigen::SparseMatrix<double>& Jx,
+                     const Eigen::VectorXd& fx,
+                     DogLegGaussStep dogLegGaussStep,
+                     Eigen::VectorXd& h_gn)
+{
+    bool solved = false;
+    if (dogLegGaussStep == FullPivLU) {
+        if (Jx.rows() == Jx.cols()) {
+            Eigen::SparseLU<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> lu(Jx);
+            if (lu.info() == Eigen::Success) {
+                h_gn = lu.solve(-fx);
+                solved = true;
+            }
+        }
+    }
+    else {
+        Eigen::SparseMatrix<double> JJt = Jx * Jx.transpose();
+        Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(JJt);
+        if (ldlt.info() == Eigen::Success) {
+            h_gn = Jx.transpose() * ldlt.solve(-fx);
+            solved = true;
+        }
+    }
+    if (solved && h_gn.allFinite() && (Jx * h_gn + fx).norm() <= 1e-8 * fx.norm()) {
+        return;
+    }
+    gaussNewtonStep(Eigen::MatrixXd(Jx), fx, dogLegGaussStep, h_gn);
+}
+
+}  // namespace
+
+bool System::useSparseJacobian(SubSystem* subsys) const
+{
+    // under- and overconstrained subsystems keep the dense solution they always had
+    return sparseJacobianThreshold > 0 && subsys->pSize() >= sparseJacobianThreshold
+        && subsys->cSize() == subsys->pSize();
+}
+
 int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
+{
+    if (useSparseJacobian(subsys)) {
+        return solveLevenbergMarquardt<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+    return solveLevenbergMarquardt<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename JacobianType>
+int System::solveLevenbergMarquardt(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
@@ -2173,9 +2356,9 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
-    Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
+    JacobianType J(csize, xsize);  // Jacobi of the subsystem
+    JacobianType A(xsize, xsize);
+    Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize);
 
     subsys->redirectParams();
 
@@ -2228,7 +2411,6 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
         // Compute ||J^T e||_inf
         double g_inf = g.lpNorm<Eigen::Infinity>();
-        diag_A = A.diagonal();  // save diagonal entries so that augmentation can be later canceled
 
         // check for convergence
         if (g_inf <= eps1) {
@@ -2238,24 +2420,15 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
         // compute initial damping factor
         if (iter == 0) {
-            mu = tau * diag_A.lpNorm<Eigen::Infinity>();
+            mu = tau * Eigen::VectorXd(A.diagonal()).lpNorm<Eigen::Infinity>();
         }
 
         double h_norm {};
         // determine increment using adaptive damping
         int k = 0;
         while (k < 50) {
-            // augment normal equations A = A+uI
-            for (int i = 0; i < xsize; ++i) {
-                A(i, i) += mu;
-            }
-
-            // solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
-            double rel_error = (A * h - g).norm() / g.norm();
-
-            // check if solving works
-            if (rel_error < 1e-5) {
+            // solve augmented functions (A+uI)*h=-g and check if solving works
+            if (solveAugmented(A, mu, g, h)) {
 
                 // restrict h according to maxStep
                 double scale = subsys->maxStep(h);
@@ -2301,9 +2474,6 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
             mu *= nu;
             nu *= 2.0;
-            for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
-                A(i, i) = diag_A(i);
-            }
 
             k++;
         }
@@ -2334,6 +2504,15 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
 
 int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
+{
+    if (useSparseJacobian(subsys)) {
+        return solveDogLeg<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+    return solveDogLeg<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename JacobianType>
+int System::solveDogLeg(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
@@ -2365,7 +2544,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
                        : (dogLegGaussStep == LeastNormFullPivLU ? "LeastNormFullPivLU"
                                                                 : "LeastNormLdlt"))
                << ", xsize: " << xsize << ", csize: " << csize << ", maxIter: " << maxIterNumber
-               << "\n";
+               << ", jacobian: " << (useSparseJacobian(subsys) ? "sparse" : "dense") << "\n";
 
         const std::string tmp = stream.str();
         Base::Console().Log(tmp.c_str());
@@ -2373,7 +2552,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    JacobianType Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
     subsys->redirectParams();
@@ -2419,19 +2598,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
             h_sd = alpha * g;
 
             // get the gauss-newton step
-            // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
-            // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-            switch (dogLegGaussStep) {
-                case FullPivLU:
-                    h_gn = Jx.fullPivLu().solve(-fx);
-                    break;
-                case LeastNormFullPivLU:
-                    h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                    break;
-                case LeastNormLdlt:
-                    h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                    break;
-            }
+            gaussNewtonStep(Jx, fx, dogLegGaussStep, h_gn);
 
             double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
             if (rel_error > 1e15) {
@@ -4962,6 +5129,12 @@ int System::diagnose(Algorithm alg)
     redundantTags.clear();
     partiallyRedundantTags.clear();
 
+    // The detailed logging of the matrices is only available for the whole Jacobian
+    if (blockDiagnosis && debugMode != IterationLevel) {
+        diagnoseBlocks(alg);
+        return dofs;
+    }
+
     // This QR diagnosis uses a reduced Jacobian matrix to calculate the rank of the system
     // and identify conflicting and redundant constraints.
     //
@@ -5593,6 +5766,22 @@ void System::identifyConflictingRedundantConstraints(
         conflictGroups[j - rank].push_back(clist[jacobianconstraintmap.at(origCol)]);
     }
 
+    identifyConflictingRedundantConstraints(alg,
+                                            conflictGroups,
+                                            tagmultiplicity,
+                                            pdiagnoselist,
+                                            constrNum,
+                                            nonredundantconstrNum);
+}
+
+void System::identifyConflictingRedundantConstraints(
+    Algorithm alg,
+    std::vector<std::vector<Constraint*>>& conflictGroups,
+    const std::map<int, int>& tagmultiplicity,
+    GCS::VEC_pD& pdiagnoselist,
+    int constrNum,
+    int& nonredundantconstrNum)
+{
     // Augment the information regarding the group of constraints that are conflicting or redundant.
     if (debugMode == IterationLevel) {
         SolverReportingManager::Manager().LogGroupOfConstraints(
@@ -5821,6 +6010,348 @@ void System::identifyConflictingRedundantConstraints(
 }
 
 
+namespace
+{
+// Groups of dependent columns of a QR decomposition with column pivoting. Each column beyond
+// the rank is grouped with the pivot columns it depends on.
+template<typename T>
+std::vector<std::vector<int>>
+dependentColumnGroups(const T& qr, const Eigen::MatrixXd& R, int rank)
+{
+    std::vector<std::vector<int>> groups(qr.cols() - rank);
+    for (int j = rank; j < qr.cols(); j++) {
+        for (int row = 0; row < rank; row++) {
+            if (fabs(R(row, j)) > 1e-10) {
+                groups[j - rank].push_back(qr.colsPermutation().indices()[row]);
+            }
+        }
+        groups[j - rank].push_back(qr.colsPermutation().indices()[j]);
+    }
+    return groups;
+}
+
+std::size_t hashMatrix(const Eigen::MatrixXd& J)
+{
+    std::size_t seed = std::hash<Eigen::Index>()(J.rows())
+        ^ (std::hash<Eigen::Index>()(J.cols()) << 1);
+    for (Eigen::Index i = 0; i < J.size(); ++i) {
+        std::uint64_t bits;
+        double value = J.data()[i];
+        std::memcpy(&bits, &value, sizeof(bits));
+        seed ^= std::hash<std::uint64_t>()(bits) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+}  // namespace
+
+void System::factorizeDiagnosisBlock(DiagnosisBlock& block)
+{
+    // NOTE: This runs in worker threads, it must only read the settings of the system and must
+    // not use Base::Console.
+    const Eigen::MatrixXd& J = block.J;
+    block.rank = 0;
+    block.conflictGroups.clear();
+    block.dependentGroups.clear();
+
+    // constraints not depending on any diagnosed parameter, each of them is dependent
+    if (J.cols() == 0) {
+        for (int i = 0; i < J.rows(); ++i) {
+            block.conflictGroups.push_back({i});
+        }
+        return;
+    }
+    // parameters not used by any driving constraint, each of them is free
+    if (J.rows() == 0) {
+        for (int j = 0; j < J.cols(); ++j) {
+            block.dependentGroups.push_back({j});
+        }
+        return;
+    }
+
+    Eigen::MatrixXd R;
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (qrAlgorithm == EigenSparseQR) {
+        Eigen::SparseMatrix<double> SJ = J.sparseView();
+        SJ.makeCompressed();
+        Eigen::SparseMatrix<double> SJT = SJ.transpose();
+
+        // transposed Jacobian for the constraints
+        Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> SqrJT;
+        SqrJT.compute(SJT);
+        SqrJT.setPivotThreshold(qrpivotThreshold);
+        block.rank = SqrJT.rank();
+        if (SqrJT.cols() >= SqrJT.rows()) {
+            R = SqrJT.matrixR().triangularView<Eigen::Upper>();
+        }
+        else {
+            R = SqrJT.matrixR().topRows(SqrJT.cols()).triangularView<Eigen::Upper>();
+        }
+        eliminateNonZerosOverPivotInUpperTriangularMatrix(R, block.rank);
+        block.conflictGroups = dependentColumnGroups(SqrJT, R, block.rank);
+
+        // Jacobian for the parameters
+        Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> SqrJ;
+        SqrJ.compute(SJ);
+        SqrJ.setPivotThreshold(qrpivotThreshold);
+        int rank = SqrJ.rank();
+        if (SqrJ.cols() >= SqrJ.rows()) {
+            R = SqrJ.matrixR().triangularView<Eigen::Upper>();
+        }
+        else {
+            R = SqrJ.matrixR().topRows(SqrJ.cols()).triangularView<Eigen::Upper>();
+        }
+        eliminateNonZerosOverPivotInUpperTriangularMatrix(R, rank);
+        block.dependentGroups = dependentColumnGroups(SqrJ, R, rank);
+        return;
+    }
+#endif
+
+    Eigen::FullPivHouseholderQR<Eigen::MatrixXd> qrJT(J.transpose());
+    qrJT.setThreshold(qrpivotThreshold);
+    block.rank = qrJT.rank();
+    if (qrJT.cols() >= qrJT.rows()) {
+        R = qrJT.matrixQR().triangularView<Eigen::Upper>();
+    }
+    else {
+        R = qrJT.matrixQR().topRows(qrJT.cols()).triangularView<Eigen::Upper>();
+    }
+    eliminateNonZerosOverPivotInUpperTriangularMatrix(R, block.rank);
+    block.conflictGroups = dependentColumnGroups(qrJT, R, block.rank);
+
+    Eigen::FullPivHouseholderQR<Eigen::MatrixXd> qrJ(J);
+    qrJ.setThreshold(qrpivotThreshold);
+    int rank = qrJ.rank();
+    if (qrJ.cols() >= qrJ.rows()) {
+        R = qrJ.matrixQR().triangularView<Eigen::Upper>();
+    }
+    else {
+        R = qrJ.matrixQR().topRows(qrJ.cols()).triangularView<Eigen::Upper>();
+    }
+    eliminateNonZerosOverPivotInUpperTriangularMatrix(R, rank);
+    block.dependentGroups = dependentColumnGroups(qrJ, R, rank);
+}
+
+void System::diagnoseBlocks(Algorithm alg)
+{
+    // Same diagnosis as in diagnose(), but the reduced Jacobian is not built as a whole. The
+    // driving constraints are grouped into blocks that share no parameters. The Jacobian is block
+    // diagonal in that ordering, so its rank is the sum of the ranks of the blocks, and the
+    // dependent constraints and parameters of a block only depend on other ones of the same
+    // block. The blocks are factorized in parallel. The result of a block is kept for the next
+    // diagnosis, so that blocks not affected by an edit are not factorized again.
+#ifdef PROFILE_DIAGNOSE
+    Base::TimeElapsed start_time;
+#endif
+
+    pDependentParameters.clear();
+    pDependentParametersGroups.clear();
+
+    // list of parameters to be diagnosed (removes value parameters from driven constraints)
+    GCS::VEC_pD pdiagnoselist;
+    std::unordered_set<double*> drivenset(pdrivenlist.begin(), pdrivenlist.end());
+    std::unordered_map<double*, int> paramcols;
+    for (auto param : plist) {
+        if (drivenset.count(param) == 0 && paramcols.emplace(param, pdiagnoselist.size()).second) {
+            pdiagnoselist.push_back(param);
+        }
+    }
+
+    // rows of the reduced Jacobian (the driving constraints), and their parameter columns
+    std::vector<Constraint*> rowconstr;
+    std::vector<std::vector<int>> rowcols;
+    std::map<int, int> tagmultiplicity;
+    for (auto constr : clist) {
+        constr->revertParams();
+        if (constr->getTag() < 0 || !constr->isDriving()) {
+            continue;
+        }
+        std::vector<int> cols;
+        for (auto param : constr->params()) {
+            auto it = paramcols.find(param);
+            if (it != paramcols.end()) {
+                cols.push_back(it->second);
+            }
+        }
+        std::sort(cols.begin(), cols.end());
+        cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+        rowconstr.push_back(constr);
+        rowcols.push_back(std::move(cols));
+
+        // create tag multiplicity map
+        if (tagmultiplicity.find(constr->getTag()) == tagmultiplicity.end()) {
+            tagmultiplicity[constr->getTag()] = 0;
+        }
+        else {
+            tagmultiplicity[constr->getTag()]++;
+        }
+    }
+
+    hasDiagnosis = true;
+    dofs = pdiagnoselist.size();
+    if (!rowconstr.empty()) {
+        emptyDiagnoseMatrix = false;
+    }
+    else {
+        return;
+    }
+
+    // connected parameters through the constraints
+    std::vector<int> parent(pdiagnoselist.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto findRoot = [&parent](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    for (const auto& cols : rowcols) {
+        for (std::size_t k = 1; k < cols.size(); ++k) {
+            int a = findRoot(cols[0]);
+            int b = findRoot(cols[k]);
+            if (a != b) {
+                parent[b] = a;
+            }
+        }
+    }
+
+    struct BlockInfo
+    {
+        std::vector<int> rows;
+        std::vector<int> cols;
+        std::shared_ptr<DiagnosisBlock> result;
+    };
+    std::vector<BlockInfo> blocks;
+    std::vector<int> rootblock(pdiagnoselist.size(), -1);
+    BlockInfo freeparams;
+    for (int j = 0; j < int(pdiagnoselist.size()); ++j) {
+        int& index = rootblock[findRoot(j)];
+        if (index < 0) {
+            index = blocks.size();
+            blocks.emplace_back();
+        }
+        blocks[index].cols.push_back(j);
+    }
+    for (int i = 0; i < int(rowconstr.size()); ++i) {
+        if (rowcols[i].empty()) {
+            // zero row, it goes into its own block without columns
+            blocks.emplace_back();
+            blocks.back().rows.push_back(i);
+        }
+        else {
+            blocks[rootblock[findRoot(rowcols[i].front())]].rows.push_back(i);
+        }
+    }
+    // merge the parameters not used by any constraint into a single block
+    blocks.erase(std::remove_if(blocks.begin(),
+                                blocks.end(),
+                                [&freeparams](BlockInfo& block) {
+                                    if (!block.rows.empty()) {
+                                        return false;
+                                    }
+                                    freeparams.cols.insert(freeparams.cols.end(),
+                                                           block.cols.begin(),
+                                                           block.cols.end());
+                                    return true;
+                                }),
+                 blocks.end());
+    if (!freeparams.cols.empty()) {
+        blocks.push_back(std::move(freeparams));
+    }
+
+    // build the Jacobian of each block and look it up in the cache
+    std::unordered_multimap<std::size_t, std::shared_ptr<DiagnosisBlock>> cache;
+    std::vector<DiagnosisBlock*> pending;
+    std::vector<int> localcol(pdiagnoselist.size(), -1);
+    for (auto& block : blocks) {
+        auto result = std::make_shared<DiagnosisBlock>();
+        result->J = Eigen::MatrixXd::Zero(block.rows.size(), block.cols.size());
+        for (int j = 0; j < int(block.cols.size()); ++j) {
+            localcol[block.cols[j]] = j;
+        }
+        for (int i = 0; i < int(block.rows.size()); ++i) {
+            int row = block.rows[i];
+            for (int col : rowcols[row]) {
+                result->J(i, localcol[col]) = rowconstr[row]->grad(pdiagnoselist[col]);
+            }
+        }
+
+        std::size_t hash = hashMatrix(result->J);
+        auto range = diagnosisCache.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            const auto& cached = it->second->J;
+            if (cached.rows() == result->J.rows() && cached.cols() == result->J.cols()
+                && cached == result->J) {
+                block.result = it->second;
+                break;
+            }
+        }
+        if (!block.result) {
+            block.result = result;
+            pending.push_back(result.get());
+        }
+        cache.emplace(hash, block.result);
+    }
+
+    // factorize the new blocks, biggest first for a better balance between the threads
+    std::sort(pending.begin(), pending.end(), [](DiagnosisBlock* a, DiagnosisBlock* b) {
+        return a->J.size() > b->J.size();
+    });
+    Base::parallelFor(pending.size(), [this, &pending](std::size_t i) {
+        factorizeDiagnosisBlock(*pending[i]);
+    });
+
+    // only keep the blocks of this diagnosis
+    diagnosisCache = std::move(cache);
+
+    // assemble the results of the blocks
+    int rank = 0;
+    std::vector<std::vector<Constraint*>> conflictGroups;
+    for (const auto& block : blocks) {
+        const auto& result = *block.result;
+        rank += result.rank;
+        for (const auto& group : result.conflictGroups) {
+            conflictGroups.emplace_back();
+            for (int row : group) {
+                conflictGroups.back().push_back(rowconstr[block.rows[row]]);
+            }
+        }
+        for (const auto& group : result.dependentGroups) {
+            pDependentParametersGroups.emplace_back();
+            for (int col : group) {
+                pDependentParametersGroups.back().push_back(pdiagnoselist[block.cols[col]]);
+                pDependentParameters.push_back(pdiagnoselist[block.cols[col]]);
+            }
+        }
+    }
+
+    int paramsNum = pdiagnoselist.size();
+    int constrNum = rowconstr.size();
+    dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
+
+    // Detecting conflicting or redundant constraints
+    if (constrNum > rank) {
+        int nonredundantconstrNum;
+        identifyConflictingRedundantConstraints(alg,
+                                                conflictGroups,
+                                                tagmultiplicity,
+                                                pdiagnoselist,
+                                                constrNum,
+                                                nonredundantconstrNum);
+        if (paramsNum == rank && nonredundantconstrNum > rank) {  // over-constrained
+            dofs = paramsNum - nonredundantconstrNum;
+        }
+    }
+
+#ifdef PROFILE_DIAGNOSE
+    Base::TimeElapsed end_time;
+    Base::Console().Log("\nBlock diagnosis (%d blocks, %d factorized) - Lapsed Time: %f seconds\n",
+                        int(blocks.size()),
+                        int(pending.size()),
+                        Base::TimeElapsed::diffTimeF(start_time, end_time));
+#endif
+}
+
 void System::clearSubSystems()
 {
     isInit = false;
@@ -23,6 +23,9 @@
 #ifndef PLANEGCS_GCS_H
 #define PLANEGCS_GCS_H
 
+#include <memory>
+#include <unordered_map>
+
 #include <Eigen/QR>
 
 #include "../../SketcherGlobal.h"
@@ -146,6 +149,12 @@ private:
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
+    // LM and DogLeg on a dense (Eigen::MatrixXd) or sparse (Eigen::SparseMatrix) Jacobian
+    template<typename JacobianType>
+    int solveLevenbergMarquardt(SubSystem* subsys, bool isRedundantsolving);
+    template<typename JacobianType>
+    int solveDogLeg(SubSystem* subsys, bool isRedundantsolving);
+    bool useSparseJacobian(SubSystem* subsys) const;
 
     void makeReducedJacobian(Eigen::MatrixXd& J,
                              std::map<int, int>& jacobianconstraintmap,
@@ -190,8 +199,31 @@ private:
                                                  int rank,
                                                  int& nonredundantconstrNum);
 
+    void identifyConflictingRedundantConstraints(
+        Algorithm alg,
+        std::vector<std::vector<Constraint*>>& conflictGroups,
+        const std::map<int, int>& tagmultiplicity,
+        GCS::VEC_pD& pdiagnoselist,
+        int constrNum,
+        int& nonredundantconstrNum);
+
     void eliminateNonZerosOverPivotInUpperTriangularMatrix(Eigen::MatrixXd& R, int rank);
 
+    // A block of the reduced Jacobian whose constraints share no parameters with the rest of
+    // the system. It can be diagnosed on its own.
+    struct DiagnosisBlock
+    {
+        Eigen::MatrixXd J;  // rows are the driving constraints, cols the parameters of the block
+        int rank = 0;
+        std::vector<std::vector<int>> conflictGroups;   // groups of rows of J
+        std::vector<std::vector<int>> dependentGroups;  // groups of cols of J
+    };
+    // factorized blocks of the last diagnosis by hash of their Jacobian
+    std::unordered_multimap<std::size_t, std::shared_ptr<DiagnosisBlock>> diagnosisCache;
+
+    void diagnoseBlocks(Algorithm alg);
+    void factorizeDiagnosisBlock(DiagnosisBlock& block);
+
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
     void identifyDependentParametersSparseQR(const Eigen::MatrixXd& J,
                                              const std::map<int, int>& jacobianconstraintmap,
@@ -223,6 +255,13 @@ public:
     double convergence;
     double convergenceRedundant;
     QRAlgorithm qrAlgorithm;
+    // if true, the independent blocks of the Jacobian are diagnosed separately and in parallel
+    bool blockDiagnosis;
+    // if true, the decoupled subsystems are solved concurrently
+    bool parallelSubsystems;
+    // square subsystems with at least this many parameters are solved by LM and DogLeg on a
+    // sparse Jacobian, 0 disables it
+    int sparseJacobianThreshold;
     DogLegGaussStep dogLegGaussStep;
     double qrpivotThreshold;
     DebugMode debugMode;
@@ -276,6 +276,29 @@ void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
     calcJacobi(plist, jacobi);
 }
 
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    // a redirected parameter points into pvals, so its column is its offset in pvals
+    const double* first = pvals.data();
+    const double* last = first + psize;
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    VEC_D derivs;
+    for (int i = 0; i < csize; i++) {
+        const VEC_pD& params = clist[i]->params();
+        clist[i]->gradients(derivs);
+        for (std::size_t k = 0; k < params.size(); k++) {
+            if (params[k] >= first && params[k] < last && derivs[k] != 0.) {
+                triplets.emplace_back(i, int(params[k] - first), derivs[k]);
+            }
+        }
+    }
+
+    // the entries of a parameter appearing several times in a constraint are summed up
+    jacobi.resize(csize, psize);
+    jacobi.setFromTriplets(triplets.begin(), triplets.end());
+}
+
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
 {
     assert(grad.size() == int(params.size()));
@@ -36,10 +36,13 @@
 
 #include <boost_regex.hpp>
 
+#include <App/Application.h>
+#include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectPy.h>
 #include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Base/FileInfo.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Vector3D.h>
 #include <Base/VectorPy.h>
@@ -70,6 +73,7 @@
 #include "Geometry.h"
 #include "GeometryObject.h"
 #include "ProjectionAlgos.h"
+#include "RecomputeScheduler.h"
 #include "TechDrawExport.h"
 #include "CosmeticVertexPy.h"
 #include "DrawLeaderLinePy.h"
@@ -146,6 +150,9 @@ public:
         add_varargs_method("writeDXFPage", &Module::writeDXFPage,
             "writeDXFPage(page, filename): Exports a DrawPage to a DXF file."
         );
+        add_varargs_method("recomputePages", &Module::recomputePages,
+            "[files] = recomputePages([pages], [dxfDirectory]) -- Redraws the pages (default all pages of the active document), running the views' HLR, face finding and section cuts concurrently, and waits until they are complete. Needs no event loop, so it can be used in FreeCADCmd. If dxfDirectory is given, each page is written to dxfDirectory/PageName.dxf and the file names are returned."
+        );
         add_varargs_method("findCentroid", &Module::findCentroid,
             "vector = findCentroid(shape, direction): finds geometric centroid of shape looking in direction."
         );
@@ -809,6 +816,68 @@ private:
         return Py::None();
     }
 
+    Py::Object recomputePages(const Py::Tuple& args)
+    {
+        PyObject* pagesObj(Py_None);
+        char* dirName(nullptr);
+        if (!PyArg_ParseTuple(args.ptr(), "|Oet", &pagesObj, "utf-8", &dirName)) {
+            throw Py::TypeError("expected ([pages], [dxfDirectory])");
+        }
+        std::string dxfDirectory;
+        if (dirName) {
+            dxfDirectory = dirName;
+            PyMem_Free(dirName);
+        }
+
+        std::vector<TechDraw::DrawPage*> pages;
+        if (pagesObj == Py_None) {
+            App::Document* doc = App::GetApplication().getActiveDocument();
+            if (!doc) {
+                throw Py::RuntimeError("No active document");
+            }
+            for (auto* obj : doc->getObjectsOfType(TechDraw::DrawPage::getClassTypeId())) {
+                pages.push_back(static_cast<TechDraw::DrawPage*>(obj));
+            }
+        }
+        else if (PyObject_TypeCheck(pagesObj, &(TechDraw::DrawPagePy::Type))) {
+            pages.push_back(static_cast<TechDraw::DrawPagePy*>(pagesObj)->getDrawPagePtr());
+        }
+        else if (PySequence_Check(pagesObj)) {
+            Py::Sequence list(pagesObj);
+            for (const auto& item : list) {
+                if (!PyObject_TypeCheck(item.ptr(), &(TechDraw::DrawPagePy::Type))) {
+                    throw Py::TypeError("expected a DrawPage or a list of DrawPages");
+                }
+                pages.push_back(static_cast<TechDraw::DrawPagePy*>(item.ptr())->getDrawPagePtr());
+            }
+        }
+        else {
+            throw Py::TypeError("expected a DrawPage or a list of DrawPages");
+        }
+
+        try {
+            RecomputeScheduler::recomputePages(pages);
+        }
+        catch (Base::Exception &e) {
+            e.setPyException();
+            throw Py::Exception();
+        }
+        catch (Standard_Failure& e) {
+            throw Py::Exception(Part::PartExceptionOCCError, e.GetMessageString());
+        }
+
+        Py::List files;
+        if (!dxfDirectory.empty()) {
+            for (auto* page : pages) {
+                Base::FileInfo fi(dxfDirectory + "/" + page->getNameInDocument() + ".dxf");
+                Py::String fileName(fi.filePath());
+                writeDXFPage(Py::TupleN(Py::asObject(page->getPyObject()), fileName));
+                files.append(fileName);
+            }
+        }
+        return files;
+    }
+
     Py::Object findCentroid(const Py::Tuple& args)
     {
         PyObject *pcObjShape(nullptr);
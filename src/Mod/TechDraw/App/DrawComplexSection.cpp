@@ -120,6 +120,7 @@
 #include "DrawComplexSection.h"
 #include "DrawUtil.h"
 #include "GeometryObject.h"
+#include "RecomputeScheduler.h"
 #include "ShapeUtils.h"
 
 using namespace TechDraw;
@@ -291,7 +292,7 @@ void DrawComplexSection::makeSectionCut(const TopoDS_Shape& baseShape)
         // This is important because this variable might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [this, baseShape]{this->makeAlignedPieces(baseShape);};
-        m_alignFuture = QtConcurrent::run(std::move(lambda));
+        m_alignFuture = QtConcurrent::run(RecomputeScheduler::threadPool(), std::move(lambda));
         m_alignWatcher.setFuture(m_alignFuture);
         waitingForAlign(true);
     }
@@ -319,6 +320,18 @@ void DrawComplexSection::onSectionCutFinished()
     QObject::disconnect(connectAlignWatcher);
 }
 
+bool DrawComplexSection::finishPendingTask()
+{
+    if (connectCutWatcher) {
+        // the align task is started by the cut task, so it is known once the cut is done
+        m_cutFuture.waitForFinished();
+        m_alignFuture.waitForFinished();
+        onSectionCutFinished();
+        return true;
+    }
+    return DrawViewPart::finishPendingTask();
+}
+
 //for Aligned strategy, cut the rawShape by each segment of the tool
 //TODO: this process should replace the "makeSectionCut" from DVS
 void DrawComplexSection::makeAlignedPieces(const TopoDS_Shape& rawShape)
@@ -61,6 +61,7 @@ public:
 
     void waitingForAlign(bool s) { m_waitingForAlign = s; }
     bool waitingForAlign(void) const { return m_waitingForAlign; }
+    bool finishPendingTask() override;
 
     TopoDS_Shape getShapeForDetail() const override;
 
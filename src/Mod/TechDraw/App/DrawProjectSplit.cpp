@@ -45,8 +45,11 @@
 #include <TopoDS_Shape.hxx>
 #endif
 #include <BOPAlgo_Builder.hxx>
+#include <NCollection_UBTree.hxx>
+#include <NCollection_UBTreeFiller.hxx>
 
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 #include <Base/Parameter.h>
 
 #include "DrawProjectSplit.h"
@@ -58,6 +61,55 @@
 
 using namespace TechDraw;
 
+namespace {
+
+using BoxTree = NCollection_UBTree<int, Bnd_Box>;
+
+//! collects the indexes of the boxes in a BoxTree that intersect a given box
+class BoxSelector : public BoxTree::Selector
+{
+public:
+    explicit BoxSelector(const Bnd_Box& box) : m_box(box) {}
+
+    Standard_Boolean Reject(const Bnd_Box& box) const override
+    {
+        return m_box.IsOut(box);
+    }
+    Standard_Boolean Accept(const int& index) override
+    {
+        indexes.push_back(index);
+        return Standard_True;
+    }
+
+    std::vector<int> indexes;
+
+private:
+    Bnd_Box m_box;
+};
+
+//! the indexes of the boxes intersecting box, in ascending order
+std::vector<int> intersectingBoxes(const BoxTree& tree, const Bnd_Box& box)
+{
+    BoxSelector selector(box);
+    tree.Select(selector);
+    std::sort(selector.indexes.begin(), selector.indexes.end());
+    return selector.indexes;
+}
+
+//! fill tree with the boxes, skipping void ones
+void fillBoxTree(BoxTree& tree, const std::vector<Bnd_Box>& boxes)
+{
+    NCollection_UBTreeFiller<int, Bnd_Box> filler(tree);
+    for (int index = 0; index < static_cast<int>(boxes.size()); index++) {
+        if (!boxes[index].IsVoid()) {
+            filler.Add(index, boxes[index]);
+        }
+    }
+    filler.Fill();
+}
+
+} // namespace
+
 //===========================================================================
 // DrawProjectSplit
 //===========================================================================
@@ -164,6 +216,61 @@ bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, b
 }
 
 
+//find the points where a vertex of one edge touches the interior of another edge. The HLR algo
+//does not provide all edge intersections for edge endpoints.
+std::vector<splitPoint> DrawProjectSplit::findSplitPoints(const std::vector<TopoDS_Edge>& edges)
+{
+    int edgeCount = edges.size();
+    std::vector<Bnd_Box> boxes(edgeCount);
+    Base::parallelFor(edgeCount, [&](int iEdge) {
+        if (DrawUtil::isZeroEdge(edges[iEdge])) {
+            return;     //skip zero length edges. shouldn't happen ;)
+        }
+        BRepBndLib::AddOptimal(edges[iEdge], boxes[iEdge]);
+        boxes[iEdge].SetGap(0.1);
+    });
+    BoxTree tree;
+    fillBoxTree(tree, boxes);
+
+    //only the edges whose boxes intersect need to be checked
+    std::vector<std::vector<splitPoint>> edgeSplits(edgeCount);
+    Base::parallelFor(edgeCount, [&](int iOuter) {
+        if (boxes[iOuter].IsVoid()) {
+            return;
+        }
+        TopoDS_Vertex v1 = TopExp::FirstVertex(edges[iOuter]);
+        TopoDS_Vertex v2 = TopExp::LastVertex(edges[iOuter]);
+        for (int iInner : intersectingBoxes(tree, boxes[iOuter])) {
+            if (iInner == iOuter) {
+                continue;
+            }
+            double param = -1;
+            if (isOnEdge(edges[iInner], v1, param, false)) {
+                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
+                splitPoint s1;
+                s1.i = iInner;
+                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
+                s1.param = param;
+                edgeSplits[iOuter].push_back(s1);
+            }
+            if (isOnEdge(edges[iInner], v2, param, false)) {
+                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
+                splitPoint s2;
+                s2.i = iInner;
+                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
+                s2.param = param;
+                edgeSplits[iOuter].push_back(s2);
+            }
+        }
+    });
+
+    std::vector<splitPoint> splits;
+    for (auto& s : edgeSplits) {
+        splits.insert(splits.end(), s.begin(), s.end());
+    }
+    return splits;
+}
+
 std::vector<TopoDS_Edge> DrawProjectSplit::splitEdges(std::vector<TopoDS_Edge> edges, std::vector<splitPoint> splits)
 {
     std::vector<TopoDS_Edge> result;
@@ -592,17 +699,37 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeOverlapEdges(const std::vector<
     std::vector<TopoDS_Edge> overlapEdges;
     std::vector<bool> skipThisEdge(inEdges.size(), false);
     int edgeCount = inEdges.size();
+
+    //edges can only overlap if their boxes intersect (see isSubset), so find those pairs with a
+    //box tree and classify them in parallel.  The classification does not depend on which
+    //edges are skipped, so the loop below gives the same result as checking every pair.
+    std::vector<Bnd_Box> boxes(edgeCount);
+    Base::parallelFor(edgeCount, [&](int iEdge) {
+        BRepBndLib::Add(inEdges[iEdge], boxes[iEdge]);
+        boxes[iEdge].SetGap(0.1);           //generous
+    });
+    BoxTree tree;
+    fillBoxTree(tree, boxes);
+    std::vector<std::vector<std::pair<int, int>>> candidates(edgeCount);    //(ie1, rc) for ie0
+    Base::parallelFor(edgeCount, [&](int ie0) {
+        for (int ie1 : intersectingBoxes(tree, boxes[ie0])) {
+            if (ie1 > ie0) {
+                candidates[ie0].emplace_back(ie1, isSubset(inEdges[ie0], inEdges[ie1]));
+            }
+        }
+    });
+
     int ie0 = 0;
     for (; ie0 < edgeCount; ie0++) {
         if (skipThisEdge.at(ie0)) {
             continue;
         }
-        int ie1 = ie0 + 1;
-        for (; ie1 < edgeCount; ie1++) {
+        for (auto& candidate : candidates[ie0]) {
+            int ie1 = candidate.first;
             if (skipThisEdge.at(ie1)) {
                 continue;
             }
-            int rc = isSubset(inEdges.at(ie0), inEdges.at(ie1));
+            int rc = candidate.second;
             if (rc == e0ISSUBSET) {
                 skipThisEdge.at(ie0) = true;
                 break;      //stop checking ie0
@@ -60,6 +60,7 @@
 #include "DrawViewSection.h"
 #include "GeometryObject.h"
 #include "Preferences.h"
+#include "RecomputeScheduler.h"
 #include "ShapeUtils.h"
 
 
@@ -201,7 +202,7 @@ void DrawViewDetail::detailExec(TopoDS_Shape& shape, DrawViewPart* dvp, DrawView
     // function and might get destructed before the parallel processing finishes.
     // TODO: What about dvp and dvs? Do they live past makeDetailShape?
     auto lambda = [this, shape, dvp, dvs]{this->makeDetailShape(shape, dvp, dvs);};
-    m_detailFuture = QtConcurrent::run(std::move(lambda));
+    m_detailFuture = QtConcurrent::run(RecomputeScheduler::threadPool(), std::move(lambda));
     m_detailWatcher.setFuture(m_detailFuture);
     waitingForDetail(true);
 }
@@ -408,6 +409,17 @@ void DrawViewDetail::onMakeDetailFinished(void)
     m_tempGeometryObject = buildGeometryObject(m_scaledShape, m_viewAxis);
 }
 
+bool DrawViewDetail::finishPendingTask()
+{
+    if (waitingForDetail()) {
+        m_detailFuture.waitForFinished();
+        QObject::disconnect(connectDetailWatcher);
+        onMakeDetailFinished();
+        return true;
+    }
+    return DrawViewPart::finishPendingTask();
+}
+
 bool DrawViewDetail::waitingForResult() const
 {
     if (DrawViewPart::waitingForResult() || waitingForDetail()) {
@@ -83,6 +83,7 @@ public:
     void waitingForDetail(bool s) { m_waitingForDetail = s; }
     bool waitingForDetail(void) const { return m_waitingForDetail; }
     bool waitingForResult() const override;
+    bool finishPendingTask() override;
 
     double getFudgeRadius(void);
     TopoDS_Shape projectEdgesOntoFace(TopoDS_Shape& edgeShape,
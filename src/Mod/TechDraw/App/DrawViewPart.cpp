@@ -62,6 +62,7 @@
 #include <gp_Dir.hxx>
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
+#include <iomanip>
 #include <sstream>
 #endif
 
@@ -89,6 +90,7 @@
 #include "GeometryObject.h"
 #include "ShapeExtractor.h"
 #include "Preferences.h"
+#include "RecomputeScheduler.h"
 #include "ShapeUtils.h"
 
 using namespace TechDraw;
@@ -102,7 +104,8 @@ DrawViewPart::DrawViewPart()
       m_handleFaces(false),
       nowUnsetting(false),
       m_waitingForFaces(false),
-      m_waitingForHlr(false)
+      m_waitingForHlr(false),
+      m_hlrScaleInFlight(1.0)
 {
     static const char* group = "Projection";
     static const char* sgroup = "HLR Parameters";
@@ -148,6 +151,16 @@ DrawViewPart::DrawViewPart()
     ADD_PROPERTY_TYPE(ScrubCount, (Preferences::scrubCount()), sgroup, App::Prop_None,
                       "The number of times FreeCAD should try to clean the HLR result.");
 
+    //the HLR output for the current source shape and projection, at scale 1. Reused when only
+    //the scale or the display of the lines changes, and saved so views need not be projected
+    //again when the document is opened.
+    ADD_PROPERTY_TYPE(HlrCache, (TopoDS_Shape()), sgroup,
+                      (App::PropertyType)(App::Prop_Hidden | App::Prop_Output),
+                      "Saved hidden line removal result");
+    ADD_PROPERTY_TYPE(HlrCacheKey, (""), sgroup,
+                      (App::PropertyType)(App::Prop_Hidden | App::Prop_Output),
+                      "Source shape and projection of the saved hidden line removal result");
+
     //initialize bbox to non-garbage
     bbox = Base::BoundBox3d(Base::Vector3d(0.0, 0.0, 0.0), 0.0);
 }
@@ -292,9 +305,9 @@ void DrawViewPart::partExec(TopoDS_Shape& shape)
 
     //we need to keep using the old geometryObject until the new one is fully populated
     m_tempGeometryObject = makeGeometryForShape(shape);
-    if (CoarseView.getValue()) {
-        onHlrFinished();//poly algo does not run in separate thread, so we need to invoke
-                        //the post hlr processing manually
+    if (!waitingForHlr()) {
+        onHlrFinished();//poly algo and cached results do not run in separate thread, so we need
+                        //to invoke the post hlr processing manually
     }
 }
 
@@ -310,6 +323,9 @@ GeometryObjectPtr DrawViewPart::makeGeometryForShape(TopoDS_Shape& shape)
     bool copyMesh = false;
     BRepBuilderAPI_Copy copier(shape, copyGeometry, copyMesh);
     TopoDS_Shape localShape = copier.Shape();
+    if (!CoarseView.getValue()) {
+        m_pendingHlrKey = hlrCacheKey(localShape);
+    }
 
     gp_Pnt gCentroid = ShapeUtils::findCentroid(localShape, getProjectionCS());
     m_saveCentroid = DU::toVector3d(gCentroid);
@@ -318,6 +334,25 @@ GeometryObjectPtr DrawViewPart::makeGeometryForShape(TopoDS_Shape& shape)
     return buildGeometryObject(localShape, getProjectionCS());
 }
 
+//! identify the HLR result for a shape.  Scale is not part of the key for orthographic views,
+//! since their projection just scales with the shape, and nor is anything that only affects
+//! which of the projected lines are shown.
+std::string DrawViewPart::hlrCacheKey(const TopoDS_Shape& shape) const
+{
+    gp_Ax2 viewAxis = getProjectionCS();
+    std::stringstream key;
+    key << std::setprecision(12) << ShapeUtils::shapeHash(shape);
+    for (const gp_XYZ& coords : {viewAxis.Location().XYZ(), viewAxis.Direction().XYZ(),
+                                 viewAxis.XDirection().XYZ()}) {
+        key << ";" << coords.X() << "," << coords.Y() << "," << coords.Z();
+    }
+    key << ";" << Rotation.getValue() << ";" << IsoCount.getValue();
+    if (Perspective.getValue()) {
+        key << ";" << Focus.getValue() << ";" << getScale();
+    }
+    return key.str();
+}
+
 //! Modify a shape by centering, scaling and rotating and return the centered (but not rotated) shape
 TopoDS_Shape DrawViewPart::centerScaleRotate(const DrawViewPart *dvp, TopoDS_Shape& inOutShape,
                                              Base::Vector3d centroid)
@@ -352,12 +387,23 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     go->usePolygonHLR(CoarseView.getValue());
     go->setScrubCount(ScrubCount.getValue());
 
+    //the key is only set by makeGeometryForShape, other callers project shapes that are not cached
+    std::string cacheKey;
+    std::swap(cacheKey, m_pendingHlrKey);
+
     if (CoarseView.getValue()) {
         //the polygon approximation HLR process runs quickly, so doesn't need to be in a
         //separate thread
         go->projectShapeWithPolygonAlgo(shape, viewAxis);
     }
+    else if (!cacheKey.empty() && cacheKey == HlrCacheKey.getValue()
+             && !HlrCache.getValue().IsNull()) {
+        go->setHlrResult(ShapeUtils::scaleShape(HlrCache.getValue(), getScale()));
+    }
     else {
+        m_hlrKeyInFlight = cacheKey;
+        m_hlrScaleInFlight = getScale();
+
         //projectShape (the HLR process) runs in a separate thread since it can take a long time
         //note that &m_hlrWatcher in the third parameter is not strictly required, but using the
         //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
@@ -369,7 +415,7 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         // This is important because those variables might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [go, shape, viewAxis]{go->projectShape(shape, viewAxis);};
-        m_hlrFuture = QtConcurrent::run(std::move(lambda));
+        m_hlrFuture = QtConcurrent::run(RecomputeScheduler::threadPool(), std::move(lambda));
         m_hlrWatcher.setFuture(m_hlrFuture);
         waitingForHlr(true);
     }
@@ -398,6 +444,13 @@ void DrawViewPart::onHlrFinished()
     //the last hlr related task is to make a bbox of the results
     bbox = geometryObject->calcBoundingBox();
 
+    if (!m_hlrKeyInFlight.empty()) {
+        HlrCache.setValue(ShapeUtils::scaleShape(geometryObject->getHlrResult(),
+                                                 1.0 / m_hlrScaleInFlight));
+        HlrCacheKey.setValue(m_hlrKeyInFlight);
+        m_hlrKeyInFlight.clear();
+    }
+
     waitingForHlr(false);
     QObject::disconnect(connectHlrWatcher);
     showProgressMessage(getNameInDocument(), "has finished finding hidden lines");
@@ -416,7 +469,7 @@ void DrawViewPart::onHlrFinished()
                                  [this] { this->onFacesFinished(); });
 
             auto lambda = [this]{this->extractFaces();};
-            m_faceFuture = QtConcurrent::run(std::move(lambda));
+            m_faceFuture = QtConcurrent::run(RecomputeScheduler::threadPool(), std::move(lambda));
             m_faceWatcher.setFuture(m_faceFuture);
             waitingForFaces(true);
         }
@@ -599,60 +652,7 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {//*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::AddOptimal(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            continue;                   //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();//***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner, iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;//skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::AddOptimal(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {//bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner), v1, param, false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (DrawProjectSplit::isOnEdge((*itInner), v2, param, false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        }//inner loop
-    }    //outer loop
+    std::vector<splitPoint> splits = DrawProjectSplit::findSplitPoints(nonZero);
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits, true);
     auto last = std::unique(sorted.begin(), sorted.end(),
@@ -1034,6 +1034,26 @@ bool DrawViewPart::waitingForResult() const
     return false;
 }
 
+//! wait for the running HLR or face finding task and continue processing in this thread
+//! instead of when the event loop delivers the watcher's signal. Returns false if there was
+//! nothing to finish.
+bool DrawViewPart::finishPendingTask()
+{
+    if (waitingForHlr()) {
+        m_hlrFuture.waitForFinished();
+        QObject::disconnect(connectHlrWatcher);
+        onHlrFinished();
+        return true;
+    }
+    if (waitingForFaces()) {
+        m_faceFuture.waitForFinished();
+        QObject::disconnect(connectFaceWatcher);
+        onFacesFinished();
+        return true;
+    }
+    return false;
+}
+
 bool DrawViewPart::hasGeometry() const
 {
     if (!geometryObject) {
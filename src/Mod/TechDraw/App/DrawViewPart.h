@@ -35,6 +35,7 @@
 #include <App/FeaturePython.h>
 #include <App/PropertyLinks.h>
 #include <Base/BoundBox.h>
+#include <Mod/Part/App/PropertyTopoShape.h>
 #include <Mod/TechDraw/TechDrawGlobal.h>
 
 #include "CosmeticExtension.h"
@@ -111,6 +112,9 @@ public:
 
     App::PropertyInteger ScrubCount;
 
+    Part::PropertyPartShape HlrCache;
+    App::PropertyString HlrCacheKey;
+
     short mustExecute() const override;
     App::DocumentObjectExecReturn* execute() override;
     const char* getViewProviderName() const override { return "TechDrawGui::ViewProviderViewPart"; }
@@ -211,6 +215,7 @@ public:
     bool waitingForHlr() const { return m_waitingForHlr; }
     void waitingForHlr(bool s) { m_waitingForHlr = s; }
     virtual bool waitingForResult() const;
+    virtual bool finishPendingTask();
     void progressValueChanged(int v);
 
 public Q_SLOTS:
@@ -230,6 +235,7 @@ protected:
     virtual TechDraw::GeometryObjectPtr buildGeometryObject(TopoDS_Shape& shape,
                                                             const gp_Ax2& viewAxis);
     virtual TechDraw::GeometryObjectPtr makeGeometryForShape(TopoDS_Shape& shape);//const??
+    std::string hlrCacheKey(const TopoDS_Shape& shape) const;
     void partExec(TopoDS_Shape& shape);
     virtual void addPoints(void);
 
@@ -251,6 +257,10 @@ private:
     bool m_waitingForFaces;
     bool m_waitingForHlr;
 
+    std::string m_pendingHlrKey;    //key for the shape about to be projected
+    std::string m_hlrKeyInFlight;   //key for the shape being projected
+    double m_hlrScaleInFlight;
+
     QMetaObject::Connection connectHlrWatcher;
     QFutureWatcher<void> m_hlrWatcher;
     QFuture<void> m_hlrFuture;
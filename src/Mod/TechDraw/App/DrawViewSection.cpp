@@ -91,6 +91,7 @@
 #include "EdgeWalker.h"
 #include "GeometryObject.h"
 #include "Preferences.h"
+#include "RecomputeScheduler.h"
 
 #include "DrawViewSection.h"
 
@@ -473,7 +474,7 @@ void DrawViewSection::sectionExec(TopoDS_Shape& baseShape)
         // This is important because this variable might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [this, baseShape]{this->makeSectionCut(baseShape);};
-        m_cutFuture = QtConcurrent::run(std::move(lambda));
+        m_cutFuture = QtConcurrent::run(RecomputeScheduler::threadPool(), std::move(lambda));
         m_cutWatcher.setFuture(m_cutFuture);
         waitingForCut(true);
     }
@@ -693,6 +694,18 @@ void DrawViewSection::postSectionCutTasks()
     }
 }
 
+bool DrawViewSection::finishPendingTask()
+{
+    // waitingForCut is reset by the cut thread itself, so use the watcher connection to know if
+    // onSectionCutFinished is still due
+    if (connectCutWatcher) {
+        m_cutFuture.waitForFinished();
+        onSectionCutFinished();
+        return true;
+    }
+    return DrawViewPart::finishPendingTask();
+}
+
 bool DrawViewSection::waitingForResult() const
 {
     if (DrawViewPart::waitingForResult() || waitingForCut()) {
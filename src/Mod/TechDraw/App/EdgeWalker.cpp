@@ -28,8 +28,11 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
 # include <cmath>
+# include <set>
 # include <sstream>
+# include <unordered_map>
 # include <BRep_Tool.hxx>
 # include <BRepBuilderAPI_MakeWire.hxx>
 # include <ShapeAnalysis.hxx>
@@ -41,6 +44,7 @@
 #endif
 
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 
 #include "EdgeWalker.h"
 #include "DrawUtil.h"
@@ -49,6 +53,87 @@
 using namespace TechDraw;
 using namespace boost;
 
+namespace {
+
+//! a hash grid of points, to find the points near a position without comparing it with all of
+//! them.  Points less than cellSize apart in each coordinate are in the same or adjacent cells.
+class PointGrid
+{
+public:
+    explicit PointGrid(double cellSize) : m_cellSize(cellSize) {}
+
+    void add(const Base::Vector3d& point, std::size_t index)
+    {
+        m_cells[cellOf(point)].push_back(index);
+    }
+
+    //! the indexes of the points in the cells around point, in ascending order
+    std::vector<std::size_t> near(const Base::Vector3d& point) const
+    {
+        std::vector<std::size_t> result;
+        Cell center = cellOf(point);
+        for (long long dx = -1; dx <= 1; dx++) {
+            for (long long dy = -1; dy <= 1; dy++) {
+                for (long long dz = -1; dz <= 1; dz++) {
+                    auto it = m_cells.find(Cell{center.x + dx, center.y + dy, center.z + dz});
+                    if (it != m_cells.end()) {
+                        result.insert(result.end(), it->second.begin(), it->second.end());
+                    }
+                }
+            }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+private:
+    struct Cell
+    {
+        long long x, y, z;
+        bool operator==(const Cell& other) const
+        {
+            return x == other.x && y == other.y && z == other.z;
+        }
+    };
+    struct CellHash
+    {
+        std::size_t operator()(const Cell& cell) const
+        {
+            return std::hash<long long>()((cell.x * 73856093LL) ^ (cell.y * 19349663LL)
+                                          ^ (cell.z * 83492791LL));
+        }
+    };
+
+    Cell cellOf(const Base::Vector3d& point) const
+    {
+        return Cell{static_cast<long long>(std::floor(point.x / m_cellSize)),
+                    static_cast<long long>(std::floor(point.y / m_cellSize)),
+                    static_cast<long long>(std::floor(point.z / m_cellSize))};
+    }
+
+    double m_cellSize;
+    std::unordered_map<Cell, std::vector<std::size_t>, CellHash> m_cells;
+};
+
+//vertexEqual is true for points closer than EWTOLERANCE, and for points less than
+//2 * EWTOLERANCE apart in x and y with the same z
+constexpr double vertexCellSize = 2.0 * EWTOLERANCE;
+
+//! index of the first vertex in uniqueVert equal to vx (within EWTOLERANCE), or SIZE_MAX
+std::size_t findNearVertex(const TopoDS_Vertex& vx, const std::vector<TopoDS_Vertex>& uniqueVert,
+                          const PointGrid& grid)
+{
+    Base::Vector3d vx3d = DrawUtil::vertex2Vector(vx);
+    for (auto idx : grid.near(vx3d)) {
+        if (vx3d.IsEqual(DrawUtil::vertex2Vector(uniqueVert[idx]), EWTOLERANCE)) {
+            return idx;
+        }
+    }
+    return SIZE_MAX;
+}
+
+} // namespace
+
 //*******************************************************
 //* edgeVisior methods
 //*******************************************************
@@ -270,25 +355,19 @@ std::vector<TopoDS_Vertex> EdgeWalker:: makeUniqueVList(std::vector<TopoDS_Edge>
 {
 //    Base::Console().Message("TRACE - EW::makeUniqueVList() - edgesIn: %d\n", edges.size());
     std::vector<TopoDS_Vertex> uniqueVert;
+    PointGrid grid(vertexCellSize);
     for(auto& e:edges) {
         Base::Vector3d v1 = DrawUtil::vertex2Vector(TopExp::FirstVertex(e));
         Base::Vector3d v2 = DrawUtil::vertex2Vector(TopExp::LastVertex(e));
-        bool addv1 = true;
-        bool addv2 = true;
         //check if we've already added this vertex
-        for (const auto& v: uniqueVert) {
-            Base::Vector3d v3d = DrawUtil::vertex2Vector(v);
-            if (v3d.IsEqual(v1, EWTOLERANCE)) {
-                addv1 = false;
-            }
-            if (v3d.IsEqual(v2, EWTOLERANCE)) {
-                addv2 = false;
-            }
-        }
+        bool addv1 = findNearVertex(TopExp::FirstVertex(e), uniqueVert, grid) == SIZE_MAX;
+        bool addv2 = findNearVertex(TopExp::LastVertex(e), uniqueVert, grid) == SIZE_MAX;
         if (addv1) {
+            grid.add(v1, uniqueVert.size());
             uniqueVert.push_back(TopExp::FirstVertex(e));
         }
         if (addv2) {
+            grid.add(v2, uniqueVert.size());
             uniqueVert.push_back(TopExp::LastVertex(e));
         }
     }
@@ -302,15 +381,20 @@ std::vector<WalkerEdge> EdgeWalker::makeWalkerEdges(std::vector<TopoDS_Edge> edg
 {
 //    Base::Console().Message("TRACE - EW::makeWalkerEdges() - edges: %d  verts: %d\n", edges.size(), verts.size());
     m_saveInEdges = edges;
+    PointGrid grid(vertexCellSize);
+    for (std::size_t iVert = 0; iVert < verts.size(); iVert++) {
+        grid.add(DrawUtil::vertex2Vector(verts[iVert]), iVert);
+    }
+
     std::vector<WalkerEdge> walkerEdges;
     for (const auto& e:edges) {
         TopoDS_Vertex edgeVertex1 = TopExp::FirstVertex(e);
         TopoDS_Vertex edgeVertex2 = TopExp::LastVertex(e);
-        std::size_t vertex1Index = findUniqueVert(edgeVertex1, verts);
+        std::size_t vertex1Index = findNearVertex(edgeVertex1, verts, grid);
         if (vertex1Index == SIZE_MAX) {
             continue;
         }
-        std::size_t vertex2Index = findUniqueVert(edgeVertex2, verts);
+        std::size_t vertex2Index = findNearVertex(edgeVertex2, verts, grid);
         if (vertex2Index == SIZE_MAX) {
             continue;
         }
@@ -387,37 +471,43 @@ std::vector<embedItem> EdgeWalker::makeEmbedding(const std::vector<TopoDS_Edge>
 {
 //    Base::Console().Message("TRACE - EW::makeEmbedding(edges: %d, verts: %d)\n",
 //                            edges.size(), uniqueVList.size());
-    std::vector<embedItem> result;
-
-    std::size_t iVert = 0;
-    //make an embedItem for each vertex in uniqueVList
-    //for each vertex v
+    //for each vertex v in uniqueVList
     //  find all the edges that have v as first or last vertex
-    for (auto& v: uniqueVList) {
-        TopoDS_Vertex cv = v;               //v is const but we need non-const for vertexEqual
-        std::size_t iEdge = 0;
-        std::vector<incidenceItem> iiList;
-        for (auto& e: edges) {
-            double angle = 0;
-            TopoDS_Vertex edgeVertex1 = TopExp::FirstVertex(e);
-            TopoDS_Vertex edgeVertex2 = TopExp::LastVertex(e);
-            if (DrawUtil::vertexEqual(cv, edgeVertex1)) {
-                angle = DrawUtil::incidenceAngleAtVertex(e,v,EWTOLERANCE);
-                incidenceItem ii(iEdge, angle, m_saveWalkerEdges[iEdge].ed);
-                iiList.push_back(ii);
-            } else if (DrawUtil::vertexEqual(cv, edgeVertex2)) {
-                angle = DrawUtil::incidenceAngleAtVertex(e,v,EWTOLERANCE);
-                incidenceItem ii(iEdge, angle, m_saveWalkerEdges[iEdge].ed);
-                iiList.push_back(ii);
+    PointGrid grid(vertexCellSize);
+    for (std::size_t iVert = 0; iVert < uniqueVList.size(); iVert++) {
+        grid.add(DrawUtil::vertex2Vector(uniqueVList[iVert]), iVert);
+    }
+    std::vector<std::vector<std::size_t>> vertexEdges(uniqueVList.size());
+    for (std::size_t iEdge = 0; iEdge < edges.size(); iEdge++) {
+        TopoDS_Vertex edgeVertex1 = TopExp::FirstVertex(edges[iEdge]);
+        TopoDS_Vertex edgeVertex2 = TopExp::LastVertex(edges[iEdge]);
+        std::vector<std::size_t> candidates = grid.near(DrawUtil::vertex2Vector(edgeVertex1));
+        std::vector<std::size_t> near2 = grid.near(DrawUtil::vertex2Vector(edgeVertex2));
+        candidates.insert(candidates.end(), near2.begin(), near2.end());
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+        for (auto iVert : candidates) {
+            TopoDS_Vertex cv = uniqueVList[iVert];    //need non-const for vertexEqual
+            if (DrawUtil::vertexEqual(cv, edgeVertex1) || DrawUtil::vertexEqual(cv, edgeVertex2)) {
+                vertexEdges[iVert].push_back(iEdge);
             }
-            iEdge++;
-       }
-       //sort incidenceList by angle
-       iiList = embedItem::sortIncidenceList(iiList,  false);
-       embedItem embed(iVert, iiList);
-       result.push_back(embed);
-       iVert++;
+        }
     }
+
+    //make an embedItem for each vertex in uniqueVList. The incidence angles are independent, so
+    //the vertexes are handled in parallel.
+    std::vector<embedItem> result(uniqueVList.size());
+    Base::parallelFor(uniqueVList.size(), [&](std::size_t iVert) {
+        const TopoDS_Vertex& v = uniqueVList[iVert];
+        std::vector<incidenceItem> iiList;
+        for (auto iEdge : vertexEdges[iVert]) {
+            double angle = DrawUtil::incidenceAngleAtVertex(edges[iEdge], v, EWTOLERANCE);
+            iiList.emplace_back(iEdge, angle, m_saveWalkerEdges[iEdge].ed);
+        }
+        //sort incidenceList by angle
+        iiList = embedItem::sortIncidenceList(iiList, false);
+        result[iVert] = embedItem(static_cast<int>(iVert), iiList);
+    });
     return result;
 }
 
@@ -509,21 +599,17 @@ std::size_t ewWire::size(void)
 ewWireList ewWireList::removeDuplicateWires()
 {
     ewWireList result;
-    if (wires.empty()) {
-        return result;
-    }
-    result.push_back(*(wires.begin()));                //save the first ewWire
-    std::vector<ewWire>::iterator iWire = (wires.begin()) + 1;    //starting with second
-    for (; iWire != wires.end(); iWire++) {
-        bool addToResult = true;
-        for (auto& w:result.wires) {
-            if ((*iWire).isEqual(w))  {             //already in result?
-                addToResult = false;
-                break;
-            }
+    //the sorted edge indexes of each wire kept so far
+    std::set<std::vector<std::size_t>> edgeSets;
+    for (auto& wire : wires) {
+        std::sort(wire.wedges.begin(), wire.wedges.end(), WalkerEdge::weCompare);
+        std::vector<std::size_t> edgeSet;
+        edgeSet.reserve(wire.wedges.size());
+        for (auto& we : wire.wedges) {
+            edgeSet.push_back(we.idx);
         }
-        if (addToResult) {
-            result.push_back((*iWire));
+        if (edgeSets.insert(edgeSet).second) {     //not already in result?
+            result.push_back(wire);
         }
     }
     return result;
@@ -136,7 +136,7 @@ public:
 class TechDrawExport embedItem
 {
 public:
-    embedItem();
+    embedItem() {iVertex = 0;}
     embedItem(std::size_t i,
               std::vector<incidenceItem> list) { iVertex = i; incidenceList = list;}
     ~embedItem()  = default;
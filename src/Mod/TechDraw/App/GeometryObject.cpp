@@ -49,7 +49,9 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Edge.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
@@ -247,6 +249,48 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
     makeTDGeometry();
 }
 
+//! pack the hlr output into a compound of 10 compounds, visible then hidden hard, outline,
+//! smooth, seam and iso lines. A missing category is an empty compound.
+TopoDS_Shape GeometryObject::getHlrResult() const
+{
+    BRep_Builder builder;
+    TopoDS_Compound result;
+    builder.MakeCompound(result);
+    for (auto& category : {visHard, visOutline, visSmooth, visSeam, visIso,
+                           hidHard, hidOutline, hidSmooth, hidSeam, hidIso}) {
+        if (category.IsNull()) {
+            TopoDS_Compound empty;
+            builder.MakeCompound(empty);
+            builder.Add(result, empty);
+        }
+        else {
+            builder.Add(result, category);
+        }
+    }
+    return result;
+}
+
+//! unpack a compound made by getHlrResult and convert it into TD Geometry
+void GeometryObject::setHlrResult(const TopoDS_Shape& result)
+{
+    clear();
+
+    std::vector<TopoDS_Shape*> categories {&visHard, &visOutline, &visSmooth, &visSeam, &visIso,
+                                           &hidHard, &hidOutline, &hidSmooth, &hidSeam, &hidIso};
+    auto category = categories.begin();
+    for (TopoDS_Iterator it(result); it.More() && category != categories.end(); it.Next()) {
+        if (ShapeUtils::isShapeReallyNull(it.Value())) {
+            (*category)->Nullify();
+        }
+        else {
+            **category = it.Value();
+        }
+        category++;
+    }
+
+    makeTDGeometry();
+}
+
 //convert the hlr output into TD Geometry
 void GeometryObject::makeTDGeometry()
 {
@@ -82,6 +82,10 @@ public:
 
     void projectShape(const TopoDS_Shape& input, const gp_Ax2& viewAxis);
     void projectShapeWithPolygonAlgo(const TopoDS_Shape& input, const gp_Ax2& viewAxis);
+    //! the HLR output packed into one compound, so it can be cached and reused
+    TopoDS_Shape getHlrResult() const;
+    //! use a previous HLR output instead of projecting a shape
+    void setHlrResult(const TopoDS_Shape& result);
     static TopoDS_Shape projectSimpleShape(const TopoDS_Shape& shape, const gp_Ax2& CS);
     static TopoDS_Shape simpleProjection(const TopoDS_Shape& shape, const gp_Ax2& projCS);
     static TopoDS_Shape projectFace(const TopoDS_Shape& face, const gp_Ax2& CS);
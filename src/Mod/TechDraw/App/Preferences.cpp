@@ -656,3 +656,10 @@ bool Preferences::switchOnClick()
 {
     return getPreferenceGroup("General")->GetBool("SwitchToWB", true);
 }
+
+//! the maximum number of threads running HLR, face finding and section cuts for the views.
+//! 0 means one per processor core.
+int Preferences::viewThreadCount()
+{
+    return getPreferenceGroup("General")->GetInt("ViewThreadCount", 0);
+}
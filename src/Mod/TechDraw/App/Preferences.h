@@ -152,6 +152,8 @@ public:
     static void setBalloonDragModifiers(Qt::KeyboardModifiers newModifiers);
 
     static bool switchOnClick();
+
+    static int viewThreadCount();
 };
 
 
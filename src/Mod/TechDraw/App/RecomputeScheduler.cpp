@@ -0,0 +1,133 @@
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <map>
+# include <set>
+# include <QThreadPool>
+#endif
+
+#include <App/PropertyLinks.h>
+
+#include "RecomputeScheduler.h"
+#include "DrawPage.h"
+#include "DrawViewPart.h"
+#include "Preferences.h"
+
+
+using namespace TechDraw;
+
+QThreadPool* RecomputeScheduler::threadPool()
+{
+    // never deleted, as destroying the pool at exit would wait for any HLR still running
+    static QThreadPool* pool = [] {
+        auto* newPool = new QThreadPool();
+        int threads = Preferences::viewThreadCount();
+        if (threads > 0) {
+            newPool->setMaxThreadCount(threads);
+        }
+        return newPool;
+    }();
+    return pool;
+}
+
+void RecomputeScheduler::finishViews(const std::vector<DrawViewPart*>& views)
+{
+    // finishing a task can start the next one for the same view (ex HLR > face finding), so
+    // repeat until all the views are quiet. The other views' tasks keep running in the pool
+    // while we wait for one of them.
+    bool finishedAny = true;
+    while (finishedAny) {
+        finishedAny = false;
+        for (auto* view : views) {
+            while (view->finishPendingTask()) {
+                finishedAny = true;
+            }
+        }
+    }
+}
+
+void RecomputeScheduler::recomputePages(const std::vector<DrawPage*>& pages)
+{
+    // part views in waves by the number of views they are based on. A section or detail needs
+    // its base view's centroid and cut shape, so it starts after the base view is complete.
+    std::map<int, std::vector<DrawViewPart*>> waves;
+    std::vector<DrawView*> otherViews;
+    std::set<App::DocumentObject*> seen;
+    for (auto* page : pages) {
+        for (auto* obj : page->getAllViews()) {
+            if (!seen.insert(obj).second) {
+                continue;
+            }
+            if (auto* part = dynamic_cast<DrawViewPart*>(obj)) {
+                waves[baseDepth(part)].push_back(part);
+            }
+            else if (auto* view = dynamic_cast<DrawView*>(obj)) {
+                otherViews.push_back(view);
+            }
+        }
+    }
+
+    for (auto* page : pages) {
+        page->forceRedraw(true);
+    }
+    try {
+        for (auto& wave : waves) {
+            for (auto* part : wave.second) {
+                part->recomputeFeature();
+            }
+            finishViews(wave.second);
+        }
+        // dimensions, balloons, groups etc. depend on the part views' geometry
+        for (auto* view : otherViews) {
+            view->overrideKeepUpdated(true);
+            view->recomputeFeature();
+        }
+    }
+    catch (...) {
+        for (auto* page : pages) {
+            page->forceRedraw(false);
+        }
+        throw;
+    }
+    for (auto* page : pages) {
+        page->forceRedraw(false);
+    }
+}
+
+int RecomputeScheduler::baseDepth(const DrawViewPart* view)
+{
+    int depth = 0;
+    std::set<const DrawViewPart*> visited {view};
+    while (auto* baseLink = dynamic_cast<App::PropertyLink*>(view->getPropertyByName("BaseView"))) {
+        auto* base = dynamic_cast<DrawViewPart*>(baseLink->getValue());
+        if (!base || !visited.insert(base).second) {
+            break;
+        }
+        view = base;
+        depth++;
+    }
+    return depth;
+}
@@ -0,0 +1,60 @@
+/***************************************************************************
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL              *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RecomputeScheduler_h_
+#define RecomputeScheduler_h_
+
+#include <vector>
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+class QThreadPool;
+
+namespace TechDraw
+{
+
+class DrawPage;
+class DrawViewPart;
+
+//! runs the threaded tasks of the views (HLR, face finding, section and detail cuts) on a
+//! shared, bounded pool and completes them without relying on an event loop.
+class TechDrawExport RecomputeScheduler
+{
+public:
+    //! the pool all view tasks are started on
+    static QThreadPool* threadPool();
+
+    //! wait for the outstanding tasks of the views and run their completion steps in this
+    //! thread, until none of the views has work left.
+    static void finishViews(const std::vector<DrawViewPart*>& views);
+
+    //! redraw all the views on the pages. Views that do not depend on each other are
+    //! recomputed concurrently, views based on another view (sections, details) after it.
+    static void recomputePages(const std::vector<DrawPage*>& pages);
+
+private:
+    static int baseDepth(const DrawViewPart* view);
+};
+
+}  // namespace TechDraw
+
+#endif
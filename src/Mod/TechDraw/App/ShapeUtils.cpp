@@ -61,6 +61,9 @@
 #include <gp_Pln.hxx>
 #include <gp_Trsf.hxx>
 #include <gp_Vec.hxx>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
 #endif// #ifndef _PreComp_
 
 #include <Base/Console.h>
@@ -413,6 +416,30 @@ bool  ShapeUtils::isShapeReallyNull(TopoDS_Shape shape)
     return shape.IsNull() || !TopoDS_Iterator(shape).More();
 }
 
+std::string ShapeUtils::shapeHash(const TopoDS_Shape& shape)
+{
+    // the text brep is a canonical description of the shape. We leave out the triangulation,
+    // which depends on whether and how the shape has been displayed.
+    std::ostringstream brep;
+#if OCC_VERSION_HEX >= 0x070600
+    BRepTools::Write(shape, brep, Standard_False, Standard_False, TopTools_FormatVersion_CURRENT);
+#else
+    // older versions always write the triangulation, so callers should pass a copy made
+    // without the mesh
+    BRepTools::Write(shape, brep);
+#endif
+
+    // 64 bit FNV-1a, as the hash is saved in documents and must be the same on all platforms
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : brep.str()) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    std::ostringstream result;
+    result << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return result.str();
+}
+
 bool ShapeUtils::edgesAreParallel(TopoDS_Edge edge0, TopoDS_Edge edge1)
 {
     std::pair<Base::Vector3d, Base::Vector3d> ends0 = getEdgeEnds(edge0);
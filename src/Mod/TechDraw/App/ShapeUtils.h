@@ -111,6 +111,10 @@ public:
 
     static bool isShapeReallyNull(TopoDS_Shape shape);
 
+//! returns a hash of the shape's geometry and topology (not of its identity). Equal shapes,
+//! including a shape restored from a file, have the same hash.
+    static std::string shapeHash(const TopoDS_Shape& shape);
+
     static bool edgesAreParallel(TopoDS_Edge edge0, TopoDS_Edge edge1);
 
     static TopoDS_Shape fromQt(const TopoDS_Shape& inShape);
@@ -1,4 +1,7 @@
+import os
+import tempfile
 import FreeCAD
+import TechDraw
 import unittest
 from .TechDrawTestUtilities import createPageWithSVGTemplate
 
@@ -89,6 +92,23 @@ class DrawProjectionGroupTest(unittest.TestCase):
 
         self.assertTrue("Up-to-date" in group.State)
 
+    def testRecomputePages(self):
+        """Tests that recomputePages finishes all views without an event loop"""
+        group = FreeCAD.ActiveDocument.addObject("TechDraw::DrawProjGroup", "ProjGroup")
+        self.page.addView(group)
+        group.Source = [self.fusion]
+        group.addProjection("Front")
+        group.addProjection("Top")
+        group.addProjection("Right")
+
+        with tempfile.TemporaryDirectory() as tmpDir:
+            files = TechDraw.recomputePages([self.page], tmpDir)
+            self.assertEqual(len(files), 1)
+            self.assertTrue(os.path.isfile(files[0]))
+
+        for v in group.Views:
+            self.assertTrue(v.getVisibleEdges(), "no visible edges in " + v.Label)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -6,6 +6,7 @@
 
 
 import FreeCAD
+import TechDraw
 import unittest
 from .TechDrawTestUtilities import createPageWithSVGTemplate
 from PySide import QtCore
@@ -50,5 +51,25 @@ class DrawViewPartTest(unittest.TestCase):
         self.assertEqual(len(edges), 4, "DrawViewPart has wrong number of edges")
         self.assertTrue("Up-to-date" in view.State, "DrawViewPart is not Up-to-date")
 
+    def testHlrCache(self):
+        """Tests if the HLR result is reused when only the scale changes"""
+        view = FreeCAD.ActiveDocument.addObject("TechDraw::DrawViewPart", "View")
+        self.page.addView(view)
+        view.Source = [FreeCAD.ActiveDocument.Box]
+        TechDraw.recomputePages([self.page])
+        key = view.HlrCacheKey
+        self.assertTrue(key, "DrawViewPart did not cache its HLR result")
+
+        view.ScaleType = "Custom"
+        view.Scale = 2.0 * view.Scale
+        view.SmoothVisible = not view.SmoothVisible
+        TechDraw.recomputePages([self.page])
+        self.assertEqual(view.HlrCacheKey, key, "HLR cache key depends on the scale")
+        self.assertEqual(len(view.getVisibleEdges()), 4, "cached HLR result has wrong number of edges")
+
+        view.Direction = FreeCAD.Vector(1.0, 0.0, 0.0)
+        TechDraw.recomputePages([self.page])
+        self.assertNotEqual(view.HlrCacheKey, key, "HLR cache key does not depend on the direction")
+
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+
+import unittest
+
+import FreeCAD
+import Part
+import TechDraw
+
+
+def gridEdges():
+    """Edges of a 10x10 square divided into four 5x5 quadrants by two lines
+    crossing in the middle"""
+    points = [(0, 0), (10, 0), (10, 10), (0, 10)]
+    edges = []
+    for i, start in enumerate(points):
+        end = points[(i + 1) % len(points)]
+        edges.append(Part.makeLine(FreeCAD.Vector(*start, 0), FreeCAD.Vector(*end, 0)))
+    edges.append(Part.makeLine(FreeCAD.Vector(5, 0, 0), FreeCAD.Vector(5, 10, 0)))
+    edges.append(Part.makeLine(FreeCAD.Vector(0, 5, 0), FreeCAD.Vector(10, 5, 0)))
+    return edges
+
+
+def reversedEdge(edge):
+    first = edge.Vertexes[0].Point
+    last = edge.Vertexes[-1].Point
+    return Part.makeLine(last, first)
+
+
+def faceSummary(wires):
+    """(area, edge count) of the faces bounded by wires, smallest first"""
+    summary = []
+    for wire in wires:
+        face = Part.Face(wire)
+        summary.append((round(face.Area, 6), len(wire.Edges)))
+    return sorted(summary)
+
+
+class EdgeWalkerTest(unittest.TestCase):
+    """Tests the face finding used by the views on a known edge pile"""
+
+    def testGridFaces(self):
+        """Tests that the four quadrants are found"""
+        wires = TechDraw.edgeWalker(gridEdges(), False)
+        self.assertEqual(faceSummary(wires), [(25.0, 4)] * 4)
+
+    def testOuterWire(self):
+        """Tests that the outline is added when asked for"""
+        wires = TechDraw.edgeWalker(gridEdges(), True)
+        self.assertEqual(faceSummary(wires), [(25.0, 4)] * 4 + [(100.0, 8)])
+
+        outer = TechDraw.findOuterWire(gridEdges())
+        self.assertAlmostEqual(Part.Face(outer).Area, 100.0)
+
+    def testDuplicateEdges(self):
+        """Tests that duplicate, reversed and reordered edges give the same faces"""
+        expected = faceSummary(TechDraw.edgeWalker(gridEdges(), True))
+
+        # the walker modifies its input edges, so every run gets new ones
+        edges = gridEdges() + gridEdges() + [reversedEdge(e) for e in gridEdges()]
+        edges.reverse()
+        self.assertEqual(faceSummary(TechDraw.edgeWalker(edges, True)), expected)
+
+    def testOverlappingEdges(self):
+        """Tests that partly overlapping edges do not change the faces found"""
+        expected = [area for area, _ in faceSummary(TechDraw.edgeWalker(gridEdges(), True))]
+
+        edges = gridEdges()
+        edges.append(Part.makeLine(FreeCAD.Vector(2, 0, 0), FreeCAD.Vector(8, 0, 0)))
+        edges.append(Part.makeLine(FreeCAD.Vector(5, 2, 0), FreeCAD.Vector(5, 8, 0)))
+        wires = TechDraw.edgeWalker(edges, True)
+        self.assertEqual([area for area, _ in faceSummary(wires)], expected)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <Base/Parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+TEST(Parallel, forEveryIndexOnce)
+{
+    std::vector<int> calls(1000, 0);
+    Base::parallelFor(calls.size(), [&](std::size_t index) {
+        calls[index]++;
+    });
+    EXPECT_EQ(std::count(calls.begin(), calls.end(), 1), 1000);
+}
+
+TEST(Parallel, forSingleThreadInOrder)
+{
+    std::vector<std::size_t> order;
+    Base::parallelFor(
+        5,
+        [&](std::size_t index) {
+            order.push_back(index);
+        },
+        1);
+    EXPECT_EQ(order, std::vector<std::size_t>({0, 1, 2, 3, 4}));
+}
+
+TEST(Parallel, forRethrowsLowestIndex)
+{
+    std::atomic<int> calls {0};
+    auto func = [&](std::size_t index) {
+        calls++;
+        if (index == 3 || index == 7) {
+            throw std::runtime_error(std::to_string(index));
+        }
+    };
+    try {
+        Base::parallelFor(10, func);
+        FAIL() << "no exception";
+    }
+    catch (const std::runtime_error& e) {
+        EXPECT_STREQ(e.what(), "3");
+    }
+    EXPECT_EQ(calls, 10);
+}
+
+TEST(Parallel, rangeCount)
+{
+    EXPECT_EQ(Base::parallelRangeCount(0, 16), 1U);
+    EXPECT_EQ(Base::parallelRangeCount(31, 16), 1U);
+    EXPECT_EQ(Base::parallelRangeCount(32, 16), 2U);
+    EXPECT_EQ(Base::parallelRangeCount(1000000, 1), 4 * Base::parallelThreadCount());
+}
+
+TEST(Parallel, rangesCoverAllItems)
+{
+    const std::size_t count = 10007;
+    std::vector<int> calls(count, 0);
+    Base::parallelForRanges(count, 100, [&](std::size_t begin, std::size_t end) {
+        EXPECT_LE(begin, end);
+        for (std::size_t i = begin; i < end; ++i) {
+            calls[i]++;
+        }
+    });
+    EXPECT_EQ(std::count(calls.begin(), calls.end(), 1), count);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -252,6 +252,38 @@ TEST_F(PropertyTopoShapeTest, testPropertyShapeCachePyObj)
     Py_XDECREF(pyObjOutErased);
 }
 
+TEST_F(PropertyTopoShapeTest, testPropertyShapeCacheBudget)
+{
+    // Arrange
+    PropertyShapeCache::clearAll();
+    PropertyShapeCache::resetStatistics();
+    auto faces = _boxes[2]->Shape.getShape().getSubTopoShapes(TopAbs_FACE);
+    TopoShape topoShapeOut;
+    PropertyShapeCache::setShape(_boxes[2], faces[0], "Face1");
+    auto oneEntrySize = PropertyShapeCache::getStatistics().size;
+    // Act
+    PropertyShapeCache::setCapacity(oneEntrySize * 2);
+    PropertyShapeCache::setShape(_boxes[3], faces[0], "Face1");  // Shares the geometry
+    PropertyShapeCache::setShape(_boxes[2], faces[1], "Face2");
+    PropertyShapeCache::setShape(_boxes[2], faces[2], "Face3");
+    auto stats = PropertyShapeCache::getStatistics();
+    auto gotNewest = PropertyShapeCache::getShape(_boxes[2], topoShapeOut, "Face3");
+    auto gotOldest = PropertyShapeCache::getShape(_boxes[2], topoShapeOut, "Face1");
+    auto hitStats = PropertyShapeCache::getStatistics();
+    PropertyShapeCache::setCapacity(0);
+    PropertyShapeCache::clearAll();
+    // Assert
+    EXPECT_GT(oneEntrySize, 0);
+    EXPECT_LE(stats.size, oneEntrySize * 2);
+    EXPECT_GT(stats.evictions, 0);
+    EXPECT_TRUE(gotNewest);
+    EXPECT_FALSE(gotOldest);  // Evicted as least recently used
+    EXPECT_EQ(hitStats.hits, 1);
+    EXPECT_EQ(hitStats.misses, 1);
+    EXPECT_EQ(PropertyShapeCache::getStatistics().entries, 0);
+    EXPECT_EQ(PropertyShapeCache::getStatistics().size, 0);
+}
+
 TEST_F(PropertyTopoShapeTest, testRestore)
 {
     // Test case for https://github.com/FreeCAD/FreeCAD/pull/16576
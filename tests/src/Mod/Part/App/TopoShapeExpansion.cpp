@@ -13,6 +13,7 @@
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakePolygon.hxx>
 #include <BRepBuilderAPI_MakeWire.hxx>
 #include <BRepBuilderAPI_Transform.hxx>
@@ -25,6 +26,8 @@
 #include <Geom_BezierSurface.hxx>
 #include <Geom_BSplineCurve.hxx>
 #include <gp_Pln.hxx>
+#include <gp_Pnt2d.hxx>
+#include <Precision.hxx>
 #include <ShapeFix_Wireframe.hxx>
 #include <ShapeBuild_ReShape.hxx>
 #include <TopExp_Explorer.hxx>
@@ -3290,4 +3293,64 @@ TEST_F(TopoShapeExpansionTest, makeElementOffset2D)
                               }));
 }
 
+TEST_F(TopoShapeExpansionTest, batchPointQueriesOnBox)
+{
+    // Arrange
+    TopoShape box {BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Solid(), 1L};
+    std::vector<Base::Vector3d> points {Base::Vector3d(0.5, 0.5, 0.5),
+                                        Base::Vector3d(1.0, 1.0, 1.0),
+                                        Base::Vector3d(3.0, 1.0, 1.0)};
+    // Act
+    auto distances = box.distanceToPoints(points);
+    auto states = box.classifyPoints(points, Precision::Confusion());
+    // Assert
+    ASSERT_EQ(distances.size(), 3);
+    EXPECT_DOUBLE_EQ(distances[0], 0.0);
+    EXPECT_NEAR(distances[1], 0.0, Precision::Confusion());
+    EXPECT_NEAR(distances[2], 2.0, Precision::Confusion());
+    ASSERT_EQ(states.size(), 3);
+    EXPECT_EQ(states[0], TopAbs_IN);
+    EXPECT_EQ(states[1], TopAbs_ON);
+    EXPECT_EQ(states[2], TopAbs_OUT);
+}
+
+TEST_F(TopoShapeExpansionTest, classifyPointsOnShell)
+{
+    // Arrange
+    TopoShape shell {BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shell(), 1L};
+    std::vector<Base::Vector3d> points {Base::Vector3d(0.5, 0.5, 0.5),
+                                        Base::Vector3d(1.0, 1.0, 1.0),
+                                        Base::Vector3d(3.0, 1.0, 1.0)};
+    // Act
+    auto states = shell.classifyPoints(points, Precision::Confusion());
+    // Assert
+    ASSERT_EQ(states.size(), 3);
+    EXPECT_EQ(states[0], TopAbs_OUT);
+    EXPECT_EQ(states[1], TopAbs_ON);
+    EXPECT_EQ(states[2], TopAbs_OUT);
+}
+
+TEST_F(TopoShapeExpansionTest, projectPointsOnFace)
+{
+    // Arrange
+    TopoShape face {BRepBuilderAPI_MakeFace(gp_Pln(), 0.0, 1.0, 0.0, 1.0).Face(), 1L};
+    std::vector<Base::Vector3d> points {Base::Vector3d(0.25, 0.5, 2.0),
+                                        Base::Vector3d(0.75, 0.25, -1.0)};
+    std::vector<gp_Pnt2d> params;
+    std::vector<double> distances;
+    // Act
+    face.projectPointsOnFace(points, params, distances);
+    // Assert
+    ASSERT_EQ(params.size(), 2);
+    EXPECT_NEAR(params[0].X(), 0.25, Precision::Confusion());
+    EXPECT_NEAR(params[0].Y(), 0.5, Precision::Confusion());
+    EXPECT_NEAR(distances[0], 2.0, Precision::Confusion());
+    EXPECT_NEAR(params[1].X(), 0.75, Precision::Confusion());
+    EXPECT_NEAR(params[1].Y(), 0.25, Precision::Confusion());
+    EXPECT_NEAR(distances[1], 1.0, Precision::Confusion());
+    EXPECT_THROW(TopoShape(BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Solid())
+                     .projectPointsOnFace(points, params, distances),
+                 Base::TypeError);
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
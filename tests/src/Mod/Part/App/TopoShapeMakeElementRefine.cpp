@@ -53,3 +53,22 @@ TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineBoxes)
     // TODO: Refine doesn't work on compounds, so we're going to need a binary operation or the
     // like, and those don't exist yet.  Once they do, this test can be expanded
 }
+
+TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineRowOfBoxes)
+{
+    // Arrange
+    const int boxCount = 8;
+    std::vector<Part::TopoShape> boxes;
+    for (int i = 0; i < boxCount; ++i) {
+        boxes.emplace_back(BRepPrimAPI_MakeBox(gp_Pnt(i, 0, 0), 1.0, 2.0, 3.0).Shape(), i + 1L);
+    }
+    Part::TopoShape fused;
+    fused.makeElementFuse(boxes);
+    // Act
+    Part::TopoShape refined = fused.makeElementRefine();
+    // Assert
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(refined.getShape()), 48.0);
+    EXPECT_EQ(fused.countSubElements("Face"), 4 * boxCount + 2);
+    EXPECT_EQ(refined.countSubElements("Face"), 6);  // All coplanar faces are united
+    EXPECT_EQ(refined.countSubElements("Edge"), 12);
+}
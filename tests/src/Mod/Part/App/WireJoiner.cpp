@@ -929,4 +929,63 @@ TEST_F(WireJoinerTest, IsDeleted)
     EXPECT_TRUE(wjIsDeleted.IsDeleted(edge5));
 }
 
+TEST_F(WireJoinerTest, setParallel)
+{
+    // Arrange
+
+    // Two triangles far apart from each other, a duplicate edge in the second one and a dangling
+    // edge, i.e. three independent groups of edges
+
+    auto edge1 {BRepBuilderAPI_MakeEdge(gp_Pnt(0.0, 0.0, 0.0), gp_Pnt(1.0, 0.0, 0.0)).Edge()};
+    auto edge2 {BRepBuilderAPI_MakeEdge(gp_Pnt(1.0, 0.0, 0.0), gp_Pnt(1.0, 1.0, 0.0)).Edge()};
+    auto edge3 {BRepBuilderAPI_MakeEdge(gp_Pnt(1.0, 1.0, 0.0), gp_Pnt(0.0, 0.0, 0.0)).Edge()};
+    auto edge4 {BRepBuilderAPI_MakeEdge(gp_Pnt(5.0, 0.0, 0.0), gp_Pnt(6.0, 0.0, 0.0)).Edge()};
+    auto edge5 {BRepBuilderAPI_MakeEdge(gp_Pnt(6.0, 0.0, 0.0), gp_Pnt(6.0, 1.0, 0.0)).Edge()};
+    auto edge6 {BRepBuilderAPI_MakeEdge(gp_Pnt(6.0, 1.0, 0.0), gp_Pnt(5.0, 0.0, 0.0)).Edge()};
+    auto edge7 {BRepBuilderAPI_MakeEdge(gp_Pnt(6.0, 1.0, 0.0), gp_Pnt(5.0, 0.0, 0.0)).Edge()};
+    auto edge8 {BRepBuilderAPI_MakeEdge(gp_Pnt(10.0, 0.0, 0.0), gp_Pnt(11.0, 0.0, 0.0)).Edge()};
+
+    std::vector<TopoDS_Shape> edges {edge1, edge2, edge3, edge4, edge5, edge6, edge7, edge8};
+
+    // A WireJoiner object that joins the edges on one thread
+    auto wjSerial {WireJoiner()};
+    // A WireJoiner object that joins every group of edges on its own
+    auto wjParallel {WireJoiner()};
+
+    // An empty TopoShape that will contain the open wires of wjSerial
+    auto openSerial {TopoShape(1)};
+    // An empty TopoShape that will contain the open wires of wjParallel
+    auto openParallel {TopoShape(2)};
+
+    // Act
+
+    wjSerial.setParallel(false);
+    wjSerial.addShape(edges);
+    wjSerial.Build();
+    wjSerial.getOpenWires(openSerial, nullptr, false);
+
+    wjParallel.setParallel(true);
+    wjParallel.addShape(edges);
+    wjParallel.Build();
+    wjParallel.getOpenWires(openParallel, nullptr, false);
+
+    // Assert
+
+    // Both objects find the same two closed wires and the same open wire
+    EXPECT_EQ(TopoShape(wjSerial.Shape()).getSubTopoShapes(TopAbs_WIRE).size(), 2);
+    EXPECT_EQ(TopoShape(wjParallel.Shape()).getSubTopoShapes(TopAbs_WIRE).size(), 2);
+    EXPECT_EQ(TopoShape(wjParallel.Shape()).getSubTopoShapes(TopAbs_EDGE).size(), 6);
+    EXPECT_EQ(openSerial.getSubTopoShapes(TopAbs_EDGE).size(), 1);
+    EXPECT_EQ(openParallel.getSubTopoShapes(TopAbs_EDGE).size(), 1);
+
+    // The history of every group is collected in the result
+    EXPECT_TRUE(wjParallel.IsDeleted(edge7));
+    EXPECT_FALSE(wjParallel.IsDeleted(edge1));
+
+    // The edges have been split in three groups
+    EXPECT_EQ(wjSerial.getStatistics().componentCount, 1);
+    EXPECT_EQ(wjParallel.getStatistics().componentCount, 3);
+    EXPECT_EQ(wjParallel.getStatistics().edgeCount, 8);
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
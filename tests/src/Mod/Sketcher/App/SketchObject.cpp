@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
+
 #include <FCConfig.h>
 
 #include <App/Application.h>
@@ -9,6 +11,7 @@
 #include <App/Expression.h>
 #include <App/ObjectIdentifier.h>
 #include <Mod/Sketcher/App/GeoEnum.h>
+#include <Mod/Sketcher/App/Sketch.h>
 #include <Mod/Sketcher/App/SketchObject.h>
 #include <src/App/InitApplication.h>
 
@@ -1275,3 +1278,180 @@ TEST_F(SketchObjectTest, testGetElementName)
     EXPECT_STREQ(reverse_export_name.newName.c_str(), (";" + tagName + "v1;SKT.Vertex1").c_str());
     EXPECT_STREQ(reverse_export_name.oldName.c_str(), "Vertex1");
 }
+
+TEST_F(SketchObjectTest, testSetDatumRepeatedly)
+{
+    // Arrange
+    Part::GeomCircle circle;
+    setupCircle(circle);
+    int geoId = getObject()->addGeometry(&circle);
+    auto constraint = std::make_unique<Sketcher::Constraint>();
+    constraint->Type = Sketcher::ConstraintType::Radius;
+    constraint->First = geoId;
+    constraint->setValue(3.0);
+    int constrId = getObject()->addConstraint(std::move(constraint));
+    getObject()->solve();
+
+    for (double radius : {4.0, 5.0, 2.5}) {
+        // Act
+        int err = getObject()->setDatum(constrId, radius);
+
+        // Assert
+        EXPECT_EQ(err, 0);
+        auto result = static_cast<const Part::GeomCircle*>(getObject()->getGeometry(geoId));
+        EXPECT_NEAR(result->getRadius(), radius, 1e-7);
+        EXPECT_DOUBLE_EQ(getObject()->Constraints.getValues()[constrId]->getValue(), radius);
+    }
+
+}
+
+TEST_F(SketchObjectTest, testSetDatumUnreachable)
+{
+    // Arrange: a line with a horizontal distance of 2 and a length of 2.5
+    Part::GeomLineSegment lineSeg;
+    lineSeg.setPoints(Base::Vector3d(0.0, 0.0, 0.0), Base::Vector3d(2.0, 1.5, 0.0));
+    int geoId = getObject()->addGeometry(&lineSeg);
+    auto constraint = std::make_unique<Sketcher::Constraint>();
+    constraint->Type = Sketcher::ConstraintType::DistanceX;
+    constraint->First = geoId;
+    constraint->setValue(2.0);
+    getObject()->addConstraint(std::move(constraint));
+    constraint = std::make_unique<Sketcher::Constraint>();
+    constraint->Type = Sketcher::ConstraintType::Distance;
+    constraint->First = geoId;
+    constraint->setValue(2.5);
+    int constrId = getObject()->addConstraint(std::move(constraint));
+    ASSERT_EQ(getObject()->solve(), 0);
+
+    // Act: a length shorter than the horizontal distance can't be solved in place, nor after
+    // setting up the sketch again
+    int err = getObject()->setDatum(constrId, 1.0);
+
+    // Assert: the datum is rejected and the old value is kept
+    EXPECT_NE(err, 0);
+    EXPECT_DOUBLE_EQ(getObject()->Constraints.getValues()[constrId]->getValue(), 2.5);
+}
+
+TEST_F(SketchObjectTest, testSetDatumWithBlockConstraint)
+{
+    // Arrange: a blocked line next to a circle with a radius
+    Part::GeomLineSegment lineSeg;
+    setupLineSegment(lineSeg);
+    int lineId = getObject()->addGeometry(&lineSeg);
+    Part::GeomCircle circle;
+    setupCircle(circle);
+    int circleId = getObject()->addGeometry(&circle);
+    auto constraint = std::make_unique<Sketcher::Constraint>();
+    constraint->Type = Sketcher::ConstraintType::Block;
+    constraint->First = lineId;
+    getObject()->addConstraint(std::move(constraint));
+    constraint = std::make_unique<Sketcher::Constraint>();
+    constraint->Type = Sketcher::ConstraintType::Radius;
+    constraint->First = circleId;
+    constraint->setValue(3.0);
+    int constrId = getObject()->addConstraint(std::move(constraint));
+    ASSERT_EQ(getObject()->solve(), 0);
+
+    // Act: block constraints make setDatum() set up the whole sketch again
+    int err = getObject()->setDatum(constrId, 4.0);
+
+    // Assert
+    EXPECT_EQ(err, 0);
+    auto result = static_cast<const Part::GeomCircle*>(getObject()->getGeometry(circleId));
+    EXPECT_NEAR(result->getRadius(), 4.0, 1e-7);
+    auto line = static_cast<const Part::GeomLineSegment*>(getObject()->getGeometry(lineId));
+    EXPECT_EQ(line->getStartPoint(), lineSeg.getStartPoint());
+    EXPECT_EQ(line->getEndPoint(), lineSeg.getEndPoint());
+}
+
+TEST_F(SketchObjectTest, testUpdateDatumInPlace)
+{
+    // Arrange: a solver sketch of a line with a length
+    Part::GeomLineSegment lineSeg;
+    setupLineSegment(lineSeg);
+    std::vector<Part::Geometry*> geometries {&lineSeg};
+    Sketcher::Constraint length;
+    length.Type = Sketcher::ConstraintType::Distance;
+    length.First = 0;
+    length.setValue(2.0);
+    std::vector<Sketcher::Constraint*> constraints {&length};
+    Sketcher::Sketch sketch;
+    ASSERT_GE(sketch.setUpSketch(geometries, constraints), 0);
+    ASSERT_EQ(sketch.solve(), 0);
+    std::unique_ptr<Sketcher::Constraint> changed(length.clone());
+    changed->setValue(5.0);
+
+    // Act
+    bool updated = sketch.updateDatum(constraints, 0, changed.get(), 1);
+    int err = sketch.solve();
+
+    // Assert: the new length is solved without setting the sketch up again
+    EXPECT_TRUE(updated);
+    EXPECT_EQ(err, 0);
+    Base::Vector3d start = sketch.getPoint(0, Sketcher::PointPos::start);
+    Base::Vector3d end = sketch.getPoint(0, Sketcher::PointPos::end);
+    EXPECT_NEAR((end - start).Length(), 5.0, 1e-7);
+
+    // A constraint list the sketch was not set up from is refused
+    std::unique_ptr<Sketcher::Constraint> other(length.clone());
+    std::vector<Sketcher::Constraint*> otherConstraints {other.get()};
+    EXPECT_FALSE(sketch.updateDatum(otherConstraints, 0, changed.get(), 1));
+    EXPECT_FALSE(sketch.updateDatum(constraints, 0, changed.get(), 2));
+}
+
+TEST_F(SketchObjectTest, testDetectMissingPointOnPointConstraints)
+{
+    // Arrange: a closed square whose first corner is already constrained
+    std::vector<Base::Vector3d> corners {{0.0, 0.0, 0.0},
+                                         {1.0, 0.0, 0.0},
+                                         {1.0, 1.0, 0.0},
+                                         {0.0, 1.0, 0.0}};
+    for (size_t i = 0; i < corners.size(); ++i) {
+        Part::GeomLineSegment lineSeg;
+        lineSeg.setPoints(corners[i], corners[(i + 1) % corners.size()]);
+        getObject()->addGeometry(&lineSeg);
+    }
+    auto constraint = std::make_unique<Sketcher::Constraint>();
+    constraint->Type = Sketcher::ConstraintType::Coincident;
+    constraint->First = 0;
+    constraint->FirstPos = Sketcher::PointPos::end;
+    constraint->Second = 1;
+    constraint->SecondPos = Sketcher::PointPos::start;
+    getObject()->addConstraint(std::move(constraint));
+
+    // Act
+    int missing = getObject()->detectMissingPointOnPointConstraints();
+
+    // Assert: the three other corners are reported, each once
+    EXPECT_EQ(missing, 3);
+    std::set<std::pair<int, int>> pairs;
+    for (auto& id : getObject()->getMissingPointOnPointConstraints()) {
+        pairs.emplace(std::min(id.First, id.Second), std::max(id.First, id.Second));
+    }
+    EXPECT_EQ(pairs, (std::set<std::pair<int, int>> {{0, 3}, {1, 2}, {2, 3}}));
+}
+
+TEST_F(SketchObjectTest, testDetectMissingEqualityConstraints)
+{
+    // Arrange: three lines of the same length, two of them already equal
+    for (double y : {0.0, 1.0, 2.0}) {
+        Part::GeomLineSegment lineSeg;
+        lineSeg.setPoints(Base::Vector3d(0.0, y, 0.0), Base::Vector3d(2.0, y, 0.0));
+        getObject()->addGeometry(&lineSeg);
+    }
+    auto constraint = std::make_unique<Sketcher::Constraint>();
+    constraint->Type = Sketcher::ConstraintType::Equal;
+    constraint->First = 1;
+    constraint->Second = 0;
+    getObject()->addConstraint(std::move(constraint));
+
+    // Act
+    int missing = getObject()->detectMissingEqualityConstraints(Precision::Confusion());
+
+    // Assert
+    EXPECT_EQ(missing, 1);
+    auto& constraints = getObject()->getMissingLineEqualityConstraints();
+    ASSERT_EQ(constraints.size(), 1);
+    EXPECT_EQ(constraints[0].First, 0);
+    EXPECT_EQ(constraints[0].Second, 2);
+}
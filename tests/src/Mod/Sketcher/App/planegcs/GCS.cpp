@@ -1,5 +1,9 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
 #include <gtest/gtest.h>
 
 #include "Mod/Sketcher/App/planegcs/GCS.h"
@@ -35,6 +39,55 @@ private:
     std::unique_ptr<SystemTest> _system;
 };
 
+// A chain of points starting at a fixed point, with the distance between neighbours constrained
+// and the angle between every angleStep-th pair of neighbours, 0 for none. Returns the solver
+// result, the solved values are left in values and the time spent in the solver, without the
+// diagnosis, in solveTime.
+int solveChain(int numPoints,
+               int sparseJacobianThreshold,
+               GCS::Algorithm alg,
+               int angleStep,
+               std::vector<double>& values,
+               double* solveTime = nullptr)
+{
+    values.resize(2 * numPoints);
+    for (int i = 0; i < numPoints; ++i) {
+        values[2 * i] = 1.1 * i + 0.3 * std::sin(i);
+        values[2 * i + 1] = 0.2 * std::cos(3 * i);
+    }
+    std::vector<GCS::Point> points(numPoints);
+    std::vector<double*> params;
+    for (int i = 0; i < numPoints; ++i) {
+        points[i].x = &values[2 * i];
+        points[i].y = &values[2 * i + 1];
+        if (i > 0) {
+            params.push_back(points[i].x);
+            params.push_back(points[i].y);
+        }
+    }
+    double distance = 1.0;
+    double angle = 0.1;
+    SystemTest system;
+    system.sparseJacobianThreshold = sparseJacobianThreshold;
+    int tag = 1;
+    for (int i = 0; i + 1 < numPoints; ++i) {
+        system.addConstraintP2PDistance(points[i], points[i + 1], &distance, tag++);
+        if (angleStep > 0 && i % angleStep == 0) {
+            system.addConstraintP2PAngle(points[i], points[i + 1], &angle, tag++);
+        }
+    }
+    system.declareUnknowns(params);
+    system.initSolution(alg);
+    auto start = std::chrono::steady_clock::now();
+    int result = system.solve(true, alg);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    system.applySolution();
+    if (solveTime) {
+        *solveTime = elapsed.count();
+    }
+    return result;
+}
+
 TEST_F(GCSTest, clearConstraints)  // NOLINT
 {
     // Arrange
@@ -50,3 +103,162 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, blockDiagnosisMatchesFullDiagnosis)  // NOLINT
+{
+    for (bool blockDiagnosis : {false, true}) {
+        // Arrange
+        std::vector<double> values {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+        std::vector<double*> params;
+        for (auto& value : values) {
+            params.push_back(&value);
+        }
+        double diff1 = 1.0;
+        double diff2 = 2.0;
+        double diff3 = 5.0;
+        SystemTest system;
+        system.blockDiagnosis = blockDiagnosis;
+        // redundant
+        system.addConstraintEqual(params[0], params[1], 1);
+        system.addConstraintEqual(params[1], params[2], 2);
+        system.addConstraintEqual(params[0], params[2], 3);
+        // conflicting
+        system.addConstraintDifference(params[3], params[4], &diff1, 4);
+        system.addConstraintDifference(params[4], params[5], &diff2, 5);
+        system.addConstraintDifference(params[3], params[5], &diff3, 6);
+        // independent
+        system.addConstraintEqual(params[6], params[7], 7);
+        system.declareUnknowns(params);
+
+        // Act
+        system.initSolution();
+        GCS::VEC_I conflicting;
+        GCS::VEC_I redundant;
+        std::vector<std::vector<double*>> groups;
+        system.getConflicting(conflicting);
+        system.getRedundant(redundant);
+        system.getDependentParamsGroups(groups);
+
+        // Assert
+        EXPECT_EQ(system.dofsNumber(), 4);
+        EXPECT_EQ(conflicting, (GCS::VEC_I {4, 5, 6}));
+        EXPECT_EQ(redundant, (GCS::VEC_I {3}));
+        EXPECT_EQ(groups.size(), 4);
+    }
+}
+
+TEST_F(GCSTest, parallelSubsystemsSolveLikeSerial)  // NOLINT
+{
+    // Arrange
+    const int numChains {20};
+    const int chainLength {5};
+    std::vector<std::vector<double>> solutions;
+    for (bool parallelSubsystems : {false, true}) {
+        std::vector<double> values(2 * numChains * chainLength);
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = double(i % 7) * 0.3;
+        }
+        std::vector<GCS::Point> points(numChains * chainLength);
+        std::vector<double*> params;
+        for (size_t i = 0; i < points.size(); ++i) {
+            points[i].x = &values[2 * i];
+            points[i].y = &values[2 * i + 1];
+            params.push_back(points[i].x);
+            params.push_back(points[i].y);
+        }
+        double distance = 1.5;
+        double angle = 0.3;
+        SystemTest system;
+        system.parallelSubsystems = parallelSubsystems;
+        int tag = 1;
+        for (int chain = 0; chain < numChains; ++chain) {
+            for (int i = chain * chainLength; i + 1 < (chain + 1) * chainLength; ++i) {
+                system.addConstraintP2PDistance(points[i], points[i + 1], &distance, tag++);
+                system.addConstraintP2PAngle(points[i], points[i + 1], &angle, tag++);
+            }
+        }
+        system.declareUnknowns(params);
+        system.initSolution();
+
+        // Act
+        int result = system.solve(true, GCS::DogLeg);
+        system.applySolution();
+
+        // Assert
+        EXPECT_EQ(result, GCS::Success);
+        solutions.push_back(values);
+    }
+    EXPECT_EQ(solutions[0], solutions[1]);
+}
+
+TEST_F(GCSTest, sparseJacobianSolvesLikeDense)  // NOLINT
+{
+    for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+        for (bool withAngles : {false, true}) {
+            // Arrange
+            const int numPoints {20};
+            std::vector<double> dense;
+            std::vector<double> sparse;
+
+            // Act
+            int denseResult = solveChain(numPoints, 0, alg, withAngles ? 1 : 0, dense);
+            int sparseResult = solveChain(numPoints, 1, alg, withAngles ? 1 : 0, sparse);
+
+            // Assert
+            EXPECT_EQ(denseResult, GCS::Success);
+            EXPECT_EQ(sparseResult, GCS::Success);
+            for (int i = 0; i + 1 < numPoints; ++i) {
+                EXPECT_NEAR(std::hypot(sparse[2 * i + 2] - sparse[2 * i],
+                                       sparse[2 * i + 3] - sparse[2 * i + 1]),
+                            1.0,
+                            1e-9);
+            }
+            if (withAngles) {
+                for (size_t i = 0; i < dense.size(); ++i) {
+                    EXPECT_NEAR(dense[i], sparse[i], 1e-9);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(GCSTest, sparseJacobianKeepsUnderconstrainedSolution)  // NOLINT
+{
+    // with only some of the angles the chain is underconstrained and the solution depends on
+    // the decomposition, it must not change when the sparse Jacobian is enabled
+    for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+        for (int angleStep : {0, 2, 3, 5}) {
+            // Arrange
+            const int numPoints {20};
+            std::vector<double> dense;
+            std::vector<double> sparse;
+
+            // Act
+            int denseResult = solveChain(numPoints, 0, alg, angleStep, dense);
+            int sparseResult = solveChain(numPoints, 1, alg, angleStep, sparse);
+
+            // Assert
+            EXPECT_EQ(denseResult, GCS::Success);
+            EXPECT_EQ(sparseResult, GCS::Success);
+            for (size_t i = 0; i < dense.size(); ++i) {
+                EXPECT_NEAR(dense[i], sparse[i], 1e-12);
+            }
+        }
+    }
+}
+
+// Scaling of the dense and sparse Jacobian with the size of the sketch, run with
+// --gtest_also_run_disabled_tests
+TEST_F(GCSTest, DISABLED_sparseJacobianScaling)  // NOLINT
+{
+    for (int numPoints : {50, 100, 200, 400, 800}) {
+        for (int threshold : {0, 1}) {
+            std::vector<double> values;
+            double solveTime {};
+            int result = solveChain(numPoints, threshold, GCS::DogLeg, 1, values, &solveTime);
+            EXPECT_EQ(result, GCS::Success);
+            std::cout << numPoints << " points, " << (threshold > 0 ? "sparse" : "dense")
+                      << " Jacobian: " << solveTime << " s" << std::endl;
+        }
+    }
+}